@@ -54,15 +54,15 @@ bool init_graphics() noexcept
 
 	//Depth buffer setup
 	glDepthMask(GL_TRUE);
-	glDepthFunc(GL_LEQUAL);
+	graphics::gl::DepthFunc(GL_LEQUAL);
 	glDepthRange(0.0f, 1.0f);
-	glEnable(GL_DEPTH_TEST);
+	graphics::gl::Enable(GL_DEPTH_TEST);
 	
 	glAlphaFunc(GL_GREATER, 0.0f); //Only draw pixels greater than 0% alpha
-	glEnable(GL_ALPHA_TEST);
+	graphics::gl::Enable(GL_ALPHA_TEST);
 
-	glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-	glEnable(GL_BLEND);
+	graphics::gl::BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+	graphics::gl::Enable(GL_BLEND);
 	return true;
 }
 
@@ -133,40 +133,48 @@ void wait_for(duration seconds) noexcept
 
 bool Engine::NotifyFrameStarted(duration time) noexcept
 {
-	for (auto &listener : FrameEventsBase::Listeners())
-	{
-		if (!FrameEventsBase::Notify(&events::listeners::FrameListener::FrameStarted, listener, time).value_or(true))
-			return false;
-	}
-
-	return true;
+	return FrameEventsBase::ForEachListener(
+		[&](events::listeners::FrameListener &listener) noexcept
+		{
+			return listener.FrameStarted(time);
+		});
 }
 
 bool Engine::NotifyFrameEnded(duration time) noexcept
 {
-	for (auto &listener : FrameEventsBase::Listeners())
-	{
-		if (!FrameEventsBase::Notify(&events::listeners::FrameListener::FrameEnded, listener, time).value_or(true))
-			return false;
-	}
-
-	return true;
+	return FrameEventsBase::ForEachListener(
+		[&](events::listeners::FrameListener &listener) noexcept
+		{
+			return listener.FrameEnded(time);
+		});
 }
 
 
-bool Engine::UpdateFrame(duration time) noexcept
+bool Engine::UpdateFrame(graphics::render::RenderWindow &render_window, duration time) noexcept
 {
 	timer_manager_.Elapse(time);
 
-	if (!NotifyFrameStarted(time))
+	//Skip the notify calls entirely when no frame listeners are registered
+	auto has_listeners = !std::empty(FrameEventsBase::Listeners());
+
+	if (has_listeners && !NotifyFrameStarted(time))
 		return false;
 
-	for (auto &viewport : render_window_->Viewports())
+	//The viewport x scene graph loop below is intentionally serial
+	//All rendering shares a single GL context, and SceneGraph::Render interleaves
+	//culling with node elapsing, event notifications and GL submission, while the
+	//culling scratch state (visible objects, lights) lives in the scene graph itself
+	//Rendering the same scene graph to two viewports concurrently would race on all of it
+	for (auto &viewport : render_window.Viewports())
 	{
 		viewport.RenderTo();
 
 		for (auto &scene_graph : SceneGraphs())
 		{
+			//Disabled scene graphs can be skipped before any render state is touched
+			if (!scene_graph.IsEnabled())
+				continue;
+
 			active_scene_graph_ = &scene_graph;
 			scene_graph.Render(viewport, time);
 		}
@@ -174,7 +182,7 @@ bool Engine::UpdateFrame(duration time) noexcept
 		active_scene_graph_ = nullptr;
 	}
 
-	return NotifyFrameEnded(time);
+	return !has_listeners || NotifyFrameEnded(time);
 }
 
 
@@ -191,6 +199,8 @@ void Engine::VerticalSync(bool vsync) noexcept
 
 void Engine::VerticalSync(VSyncMode mode) noexcept
 {
+	vsync_mode_ = mode;
+
 	switch (mode)
 	{
 		case VSyncMode::On:
@@ -225,21 +235,25 @@ void Engine::ZLimit(real from, real to) noexcept
 
 std::optional<engine::VSyncMode> Engine::VerticalSync() const noexcept
 {
+	//Mode already known, no need to round-trip to the driver
+	if (vsync_mode_)
+		return vsync_mode_;
+
 	if (auto interval = detail::get_swap_interval(); interval)
 	{
 		switch (*interval)
 		{
 			case 1:
-			return VSyncMode::On;
+			return vsync_mode_ = VSyncMode::On;
 
 			case 0:
-			return VSyncMode::Off;
+			return vsync_mode_ = VSyncMode::Off;
 
 			case -1:
-			return VSyncMode::Adaptive;
+			return vsync_mode_ = VSyncMode::Adaptive;
 
 			case -2:
-			return VSyncMode::AdaptiveHalfRate;
+			return vsync_mode_ = VSyncMode::AdaptiveHalfRate;
 		}
 	}
 
@@ -281,23 +295,32 @@ int Engine::Start() noexcept
 		return 1;
 
 
+	//Already validated by Initialize, so the main loop can
+	//use a plain reference without re-checking the optional each frame
+	auto &render_window = *render_window_;
+
 	//Show window
-	if (render_window_)
-		render_window_->Show();
+	render_window.Show();
 
 	total_stopwatch_.Restart();
 
 	//Main loop
-	while (render_window_ && render_window_->ProcessMessages())
+	while (render_window.ProcessMessages())
 	{
 		auto time = frame_stopwatch_.Restart();
 			//Time should always be 0.0 sec on first frame
 
-		if (!UpdateFrame(time))
+		last_frame_time_ = time;
+		fps_ = time > 0.0_sec ? 1.0_r / time.count() : 0.0_r;
+			//Computed once per frame, so FrameTime/FPS queries are plain loads
+
+		if (!UpdateFrame(render_window, time))
 			break;
 
-		render_window_->SwapBuffers();
-			//glFlush() or glFinish() calls are being handled by SwapBuffers
+		render_window.SwapBuffers();
+			//No explicit glFlush() or glFinish() calls are needed (or wanted) here
+			//A glFinish() would stall the CPU on a full GPU round-trip each frame
+			//SwapBuffers provides sufficient back-pressure against the GPU
 
 		if (target_frame_time_)
 		{
@@ -310,8 +333,7 @@ int Engine::Start() noexcept
 	total_stopwatch_.Stop(); //Total time could be retrieved later
 
 	//Hide window
-	if (render_window_)
-		render_window_->Hide();
+	render_window.Hide();
 
 	return 0;
 }
@@ -323,7 +345,7 @@ int Engine::Start() noexcept
 
 duration Engine::FrameTime() const noexcept
 {
-	return frame_stopwatch_.Elapsed();
+	return last_frame_time_;
 }
 
 duration Engine::TotalTime() const noexcept
@@ -333,10 +355,7 @@ duration Engine::TotalTime() const noexcept
 
 real Engine::FPS() const noexcept
 {
-	auto time = FrameTime();
-	return time > 0.0_sec ?
-		1.0_r / time.count() :
-		0.0_r;
+	return fps_;
 }
 
 
@@ -45,8 +45,8 @@ namespace ion
 
 		namespace detail
 		{
-			constexpr auto meters_to_feet_factor = 3.28084_r;
-			constexpr auto feet_to_meters_factor = 0.3048_r;
+			inline constexpr auto meters_to_feet_factor = 3.28084_r;
+			inline constexpr auto feet_to_meters_factor = 0.3048_r;
 
 
 			bool init_file_system() noexcept;
@@ -75,6 +75,9 @@ namespace ion
 			timers::Stopwatch frame_stopwatch_;
 			timers::Stopwatch total_stopwatch_;
 			std::optional<duration> target_frame_time_;
+			duration last_frame_time_ = 0.0_sec;
+			real fps_ = 0.0_r;
+			mutable std::optional<engine::VSyncMode> vsync_mode_;
 
 			std::optional<graphics::render::RenderWindow> render_window_;
 			std::optional<events::InputController> input_controller_;
@@ -95,7 +98,7 @@ namespace ion
 			bool NotifyFrameStarted(duration time) noexcept;
 			bool NotifyFrameEnded(duration time) noexcept;
 
-			bool UpdateFrame(duration time) noexcept;
+			bool UpdateFrame(graphics::render::RenderWindow &render_window, duration time) noexcept;
 
 			///@}
 
@@ -182,6 +185,8 @@ namespace ion
 			void VerticalSync(bool vsync) noexcept;
 
 			///@brief Sets the kind of vertical sync the engine should use to the given mode
+			///@details This is the single authoritative mutator, the mode set here is cached
+			///so that the VerticalSync observer does not need to round-trip to the driver
 			void VerticalSync(engine::VSyncMode mode) noexcept;
 
 
@@ -229,7 +234,8 @@ namespace ion
 			}
 
 			///@brief Returns the kind of vertical sync the engine is using
-			///@details Returns nullopt if vertical sync mode is unknown
+			///@details Returns nullopt if vertical sync mode is unknown.
+			///The mode is cached, so no driver query is made once the mode is known
 			[[nodiscard]] std::optional<engine::VSyncMode> VerticalSync() const noexcept;
 
 
@@ -13,6 +13,7 @@ File:	IonEventGenerator.h
 #ifndef ION_EVENT_GENERATOR_H
 #define ION_EVENT_GENERATOR_H
 
+#include <array>
 #include <functional>
 #include <optional>
 #include <type_traits>
@@ -34,6 +35,9 @@ namespace ion::events
 		constexpr auto has_value_type_v = has_value_type<T>::value;
 
 
+		constexpr auto max_stack_listeners = 16; //Listener snapshots above this size fall back to the heap
+
+
 		//This type is very similar to std::monostate
 		//But we do not want to #include <variant> just to get it
 		struct empty final {};
@@ -95,17 +99,26 @@ namespace ion::events
 			static_assert(event_generator::detail::has_value_type_v<Range> &&
 						  std::is_same_v<typename Range::value_type, T*>);
 
-			if (!std::empty(listeners))
+			if (auto count = std::size(listeners); count > 0)
 			{
-				std::vector<T*> listeners_to_notify;
-				listeners_to_notify.reserve(std::size(listeners));
+				std::array<T*, event_generator::detail::max_stack_listeners> local_listeners;
+				std::vector<T*> heap_listeners;
+
+				if (count > std::size(local_listeners))
+					heap_listeners.resize(count);
+
+				auto listeners_to_notify =
+					count > std::size(local_listeners) ?
+					std::data(heap_listeners) :
+					std::data(local_listeners);
 
+				auto iter = listeners_to_notify;
 				for (auto &listener : listeners)
-					listeners_to_notify.push_back(&listener);
+					*iter++ = &listener;
 
-				for (auto &listener : listeners_to_notify)
-					Notify(event, *listener, args...);
-						//The actual notify call could be modifying 'listeners', but not the 'listeners_to_notify' copy
+				for (auto last = listeners_to_notify + count; listeners_to_notify != last; ++listeners_to_notify)
+					Notify(event, **listeners_to_notify, args...);
+						//The actual notify call could be modifying 'listeners', but not the snapshot being iterated
 						//This will make sure that all listeners at the time of the event, will be notified
 			}
 		}
@@ -179,6 +179,28 @@ namespace ion::events
 
 			///@}
 
+			/**
+				@name Notifying
+				@{
+			*/
+
+			///@brief Calls the given function once for each listener that is listening
+			///@details Stops and returns false the first time the given function returns false, otherwise returns true.
+			///The function is called directly (no std::optional round-trip), so the call can be fully inlined
+			template <typename Function>
+			inline auto ForEachListener(Function function) noexcept
+			{
+				for (auto &listener : listeners_)
+				{
+					if (listener->Listening() && !function(*listener))
+						return false;
+				}
+
+				return true;
+			}
+
+			///@}
+
 			/**
 				@name Subscribing
 				@{
@@ -13,6 +13,9 @@ File:	IonGraphicsAPI.h
 #ifndef ION_GRAPHICS_API_H
 #define ION_GRAPHICS_API_H
 
+#include <optional>
+#include <utility>
+
 #include <gl/glew.h> //OpenGL API
 #define ION_GLEW
 
@@ -392,6 +395,182 @@ namespace ion::graphics::gl
 
 		return max_array_texture_layers;
 	}
+
+
+	namespace detail
+	{
+		constexpr auto max_cached_texture_units = 32;
+		constexpr auto max_cached_texture_targets = 4;
+
+
+		///@brief A minimal cache of GL state that is toggled repeatedly by the render path
+		///@details Unknown (nullopt) entries always pass the call through to the driver
+		struct render_state
+		{
+			std::optional<bool> alpha_test;
+			std::optional<bool> blend;
+			std::optional<bool> depth_test;
+			std::optional<bool> scissor_test;
+			std::optional<std::pair<GLenum, GLenum>> blend_func;
+			std::optional<GLenum> depth_func;
+
+			int active_texture_unit = 0;
+			std::optional<GLuint> bound_textures[max_cached_texture_units][max_cached_texture_targets];
+		};
+
+		inline render_state state;
+
+		inline int cached_texture_target(GLenum target) noexcept
+		{
+			switch (target)
+			{
+				case GL_TEXTURE_1D:
+				return 0;
+
+				case GL_TEXTURE_2D:
+				return 1;
+
+				case GL_TEXTURE_1D_ARRAY: //Same value as GL_TEXTURE_1D_ARRAY_EXT
+				return 2;
+
+				case GL_TEXTURE_2D_ARRAY: //Same value as GL_TEXTURE_2D_ARRAY_EXT
+				return 3;
+
+				default:
+				return -1;
+			}
+		}
+
+		inline std::optional<bool>* cached_capability(GLenum capability) noexcept
+		{
+			switch (capability)
+			{
+				case GL_ALPHA_TEST:
+				return &state.alpha_test;
+
+				case GL_BLEND:
+				return &state.blend;
+
+				case GL_DEPTH_TEST:
+				return &state.depth_test;
+
+				case GL_SCISSOR_TEST:
+				return &state.scissor_test;
+
+				default:
+				return nullptr;
+			}
+		}
+	} //detail
+
+
+	///@brief Enables the given GL capability, skipping the driver call if already enabled
+	inline void Enable(GLenum capability) noexcept
+	{
+		auto cached = detail::cached_capability(capability);
+
+		if (!cached || *cached != true)
+		{
+			glEnable(capability);
+
+			if (cached)
+				*cached = true;
+		}
+	}
+
+	///@brief Disables the given GL capability, skipping the driver call if already disabled
+	inline void Disable(GLenum capability) noexcept
+	{
+		auto cached = detail::cached_capability(capability);
+
+		if (!cached || *cached != false)
+		{
+			glDisable(capability);
+
+			if (cached)
+				*cached = false;
+		}
+	}
+
+	///@brief Sets the GL blend function, skipping the driver call if unchanged
+	inline void BlendFunc(GLenum sfactor, GLenum dfactor) noexcept
+	{
+		if (detail::state.blend_func != std::pair{sfactor, dfactor})
+		{
+			glBlendFunc(sfactor, dfactor);
+			detail::state.blend_func = std::pair{sfactor, dfactor};
+		}
+	}
+
+	///@brief Sets the GL depth function, skipping the driver call if unchanged
+	inline void DepthFunc(GLenum func) noexcept
+	{
+		if (detail::state.depth_func != func)
+		{
+			glDepthFunc(func);
+			detail::state.depth_func = func;
+		}
+	}
+
+
+	///@brief Sets the active GL texture unit, skipping the driver call if unchanged
+	inline void ActiveTexture(int texture_unit) noexcept
+	{
+		if (detail::state.active_texture_unit != texture_unit)
+		{
+			switch (MultiTexture_Support())
+			{
+				case Extension::Core:
+				glActiveTexture(GL_TEXTURE0 + texture_unit);
+				break;
+
+				#ifdef ION_GLEW
+				case Extension::ARB:
+				glActiveTextureARB(GL_TEXTURE0_ARB + texture_unit);
+				break;
+				#endif
+			}
+
+			detail::state.active_texture_unit = texture_unit;
+		}
+	}
+
+	///@brief Binds the given texture to the given target on the active texture unit,
+	///skipping the driver call if already bound
+	///@details Bindings on untracked targets or units always pass through to the driver
+	inline void BindTexture(GLenum target, GLuint texture_id) noexcept
+	{
+		auto target_index = detail::cached_texture_target(target);
+		auto unit = detail::state.active_texture_unit;
+
+		if (target_index < 0 || unit >= detail::max_cached_texture_units)
+		{
+			glBindTexture(target, texture_id);
+			return;
+		}
+
+		if (auto &cached = detail::state.bound_textures[unit][target_index];
+			cached != texture_id)
+		{
+			glBindTexture(target, texture_id);
+			cached = texture_id;
+		}
+	}
+
+	///@brief Forgets all cached bindings of the given texture
+	///@details Must be called when a texture is deleted, since the driver
+	///unbinds deleted textures and their names can be reused
+	inline void InvalidateTextureBindings(GLuint texture_id) noexcept
+	{
+		for (auto &targets : detail::state.bound_textures)
+		{
+			for (auto &cached : targets)
+			{
+				if (cached == texture_id)
+					cached = {};
+			}
+		}
+	}
 } //ion::graphics::gl
 
 #endif
\ No newline at end of file
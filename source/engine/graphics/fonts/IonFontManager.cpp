@@ -153,7 +153,7 @@ std::optional<font::GlyphTextureHandle> load_font(
 
 	if (glyph_texture_type == GlyphTextureType::ArrayTexture2D)
 	{
-		glBindTexture(GL_TEXTURE_2D_ARRAY, glyph_handle.Ids.front());
+		gl::BindTexture(GL_TEXTURE_2D_ARRAY, glyph_handle.Ids.front());
 
 		//Minification filter
 		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER,
@@ -182,13 +182,13 @@ std::optional<font::GlyphTextureHandle> load_font(
 				GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, std::data(glyph_data[i]));
 		}
 
-		glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+		gl::BindTexture(GL_TEXTURE_2D_ARRAY, 0);
 	}
 	else
 	{
 		for (auto i = 0; i < glyph_count; ++i)
 		{
-			glBindTexture(GL_TEXTURE_2D, glyph_handle.Ids[i]);
+			gl::BindTexture(GL_TEXTURE_2D, glyph_handle.Ids[i]);
 
 			//Minification filter
 			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
@@ -207,7 +207,7 @@ std::optional<font::GlyphTextureHandle> load_font(
 				GL_RGBA8, glyph_metrics[i].ActualWidth, glyph_metrics[i].ActualHeight,
 				0, GL_LUMINANCE_ALPHA, GL_UNSIGNED_BYTE, std::data(glyph_data[i]));
 
-			glBindTexture(GL_TEXTURE_2D, 0);
+			gl::BindTexture(GL_TEXTURE_2D, 0);
 		}
 	}
 
@@ -217,6 +217,9 @@ std::optional<font::GlyphTextureHandle> load_font(
 void unload_font(const font::GlyphTextureHandle &glyph_handle) noexcept
 {
 	glDeleteTextures(std::ssize(glyph_handle.Ids), reinterpret_cast<const unsigned int*>(std::data(glyph_handle.Ids)));
+
+	for (auto id : glyph_handle.Ids)
+		gl::InvalidateTextureBindings(id); //Deleted texture names can be reused
 }
 
 } //font_manager::detail
@@ -31,6 +31,15 @@ TextBlocks html_to_formatted_blocks(std::string_view content)
 
 TextLines formatted_blocks_to_formatted_lines(TextBlocks text_blocks, TextOverflow overflow,
 	const std::optional<Vector2> &area_size, const Vector2 &padding, TypeFace &type_face)
+{
+	TextLines lines;
+	formatted_blocks_to_formatted_lines(std::move(text_blocks), overflow, area_size, padding, type_face, lines);
+	return lines;
+}
+
+void formatted_blocks_to_formatted_lines(TextBlocks text_blocks, TextOverflow overflow,
+	const std::optional<Vector2> &area_size, const Vector2 &padding, TypeFace &type_face,
+	TextLines &text_lines)
 {
 	using namespace graphics::utilities;
 
@@ -73,10 +82,10 @@ TextLines formatted_blocks_to_formatted_lines(TextBlocks text_blocks, TextOverfl
 		}
 	}
 
-	auto lines = utilities::SplitTextBlocks(std::move(text_blocks));
+	utilities::SplitTextBlocks(std::move(text_blocks), text_lines);
 
 	//Measure blocks and lines
-	for (auto &line : lines)
+	for (auto &line : text_lines)
 	{
 		line.Size = vector2::Zero;
 
@@ -89,8 +98,6 @@ TextLines formatted_blocks_to_formatted_lines(TextBlocks text_blocks, TextOverfl
 			line.Size->Y(std::max(line.Size->Y(), block.Size->Y()));
 		}
 	}
-
-	return lines;
 }
 
 
@@ -166,6 +173,34 @@ size_t get_formatted_lines_offset(int line_off, const TextLines &text_lines) noe
 	return std::size(text_lines);
 }
 
+size_t last_paragraph_blocks_offset(const TextBlocks &text_blocks) noexcept
+{
+	//Returns the offset to the first block after the last hard break
+	for (auto i = std::size(text_blocks); i > 0; --i)
+	{
+		if (text_blocks[i - 1].HardBreak)
+			return i;
+	}
+
+	return 0;
+}
+
+size_t last_paragraph_lines_offset(const TextLines &text_lines) noexcept
+{
+	//Returns the offset to the first line after the last hard break
+	//The very last line is always marked as a tail, so it does not count
+	if (std::empty(text_lines))
+		return 0;
+
+	for (auto i = std::size(text_lines) - 1; i > 0; --i)
+	{
+		if (text_lines[i - 1].Tail)
+			return i;
+	}
+
+	return 0;
+}
+
 int get_line_offset(size_t content_off, std::string_view content, TextFormatting formatting) noexcept
 {
 	if (content_off == 0)
@@ -190,7 +225,9 @@ int get_line_offset(size_t content_off, std::string_view content, TextFormatting
 
 text::TextBlocks Text::MakeFormattedBlocks(std::string_view content) const
 {
-	if (formatting_ == TextFormatting::HTML)
+	if (formatting_ == TextFormatting::HTML &&
+		(std::empty(content) || content.find_first_of("<\n") != std::string_view::npos))
+			//Non-empty content without any tags or line breaks can skip the HTML parser entirely
 		return detail::html_to_formatted_blocks(content);
 	else
 		return {{{}, std::string{content}}};
@@ -207,6 +244,35 @@ text::TextLines Text::MakeFormattedLines(text::TextBlocks text_blocks,
 		return {};
 }
 
+void Text::MakeFormattedLines(text::TextBlocks text_blocks,
+	const std::optional<Vector2> &area_size, const Vector2 &padding,
+	NonOwningPtr<TypeFace> type_face, text::TextLines &text_lines) const
+{
+	if (type_face)
+		detail::formatted_blocks_to_formatted_lines(
+			std::move(text_blocks), overflow_, area_size, padding, *type_face, text_lines);
+	else
+		text_lines.clear(); //Keeps capacity
+}
+
+void Text::RebuildFormatting(bool rebuild_blocks)
+{
+	//Inside a deferred update, just mark what needs reformatting
+	if (deferred_update_)
+	{
+		dirty_blocks_ |= rebuild_blocks;
+		dirty_lines_ = true;
+	}
+	else
+	{
+		if (rebuild_blocks)
+			formatted_blocks_ = MakeFormattedBlocks(content_);
+
+		MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_, formatted_lines_);
+			//Reuses the capacity of formatted_lines_
+	}
+}
+
 
 //Public
 
@@ -282,13 +348,31 @@ Text::Text(std::string name, std::string content,
 	Modifiers
 */
 
+void Text::BeginUpdate() noexcept
+{
+	deferred_update_ = true;
+}
+
+void Text::EndUpdate()
+{
+	deferred_update_ = false;
+
+	if (dirty_blocks_)
+		formatted_blocks_ = MakeFormattedBlocks(content_);
+
+	if (dirty_lines_)
+		MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_, formatted_lines_);
+
+	dirty_blocks_ = dirty_lines_ = false;
+}
+
+
 void Text::Content(std::string content)
 {
 	if (content_ != content)
 	{
 		content_ = std::move(content);
-		formatted_blocks_ = MakeFormattedBlocks(content_);
-		formatted_lines_ = MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_);
+		RebuildFormatting(true);
 	}
 }
 
@@ -297,8 +381,7 @@ void Text::Formatting(text::TextFormatting formatting)
 	if (formatting_ != formatting)
 	{
 		formatting_ = formatting;
-		formatted_blocks_ = MakeFormattedBlocks(content_);
-		formatted_lines_ = MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_);
+		RebuildFormatting(true);
 	}
 }
 
@@ -307,7 +390,7 @@ void Text::Overflow(text::TextOverflow overflow) noexcept
 	if (overflow_ != overflow)
 	{
 		overflow_ = overflow;
-		formatted_lines_ = MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_);
+		RebuildFormatting(false);
 	}
 }
 
@@ -317,7 +400,7 @@ void Text::AreaSize(const std::optional<Vector2> &area_size)
 	if (area_size_ != area_size)
 	{
 		area_size_ = area_size;
-		formatted_lines_ = MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_);
+		RebuildFormatting(false);
 	}
 }
 
@@ -326,7 +409,7 @@ void Text::Padding(const Vector2 &padding)
 	if (padding_ != padding)
 	{
 		padding_ = padding;
-		formatted_lines_ = MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_);
+		RebuildFormatting(false);
 	}
 }
 
@@ -454,6 +537,25 @@ void Text::AppendContent(std::string_view content)
 		Content(std::string{content});
 		return;
 	}
+	else if (content.find_first_not_of('\n') == std::string_view::npos)
+	{
+		//Newline only content requires no parsing or reflow
+		//Each newline becomes a hard break block, with an empty line in-between each pair.
+		//The first newline only completes the last line, unless a trailing hard break
+		//has already completed it, in which case it flushes an empty line as well
+		auto line_count =
+			formatted_blocks_.back().HardBreak ?
+			std::size(content) : std::size(content) - 1;
+
+		content_.append(content);
+		formatted_blocks_.insert(std::end(formatted_blocks_), std::size(content), {{}, "\n", true});
+
+		if (type_face_)
+			formatted_lines_.insert(std::end(formatted_lines_), line_count,
+				{{}, true, graphics::utilities::vector2::Zero});
+
+		return;
+	}
 	else if (content.front() == '\n')
 	{
 		content.remove_prefix(1);
@@ -465,15 +567,34 @@ void Text::AppendContent(std::string_view content)
 	auto formatted_blocks = MakeFormattedBlocks(content);
 	auto iter = std::begin(formatted_blocks);
 
-	//Merge first block with the last one already in text
-	if (formatted_blocks.front() == formatted_blocks_.back())
+	//Wrapping and truncating restarts at each hard break,
+	//so reflow starts at the paragraph the new content continues (or begins).
+	//Both offsets must be taken before appending, while the last block/line
+	//still tell whether the existing text ended with a hard break
+	auto hard_break = formatted_blocks_.back().HardBreak;
+	auto block_off = detail::last_paragraph_blocks_offset(formatted_blocks_);
+	auto line_off =
+		hard_break ?
+		std::size(formatted_lines_) :
+		detail::last_paragraph_lines_offset(formatted_lines_);
+
+	//Merge first block with the last one already in text (but never into a hard break)
+	if (!hard_break &&
+		formatted_blocks.front() == formatted_blocks_.back())
 	{
 		formatted_blocks_.back().Content += formatted_blocks.front().Content;
 		++iter; //Skip first
 	}
 
 	std::move(iter, std::end(formatted_blocks), std::back_inserter(formatted_blocks_));
-	formatted_lines_ = MakeFormattedLines(formatted_blocks_, area_size_, padding_, type_face_);
+
+	auto formatted_lines = MakeFormattedLines(
+		{std::begin(formatted_blocks_) + block_off, std::end(formatted_blocks_)},
+		area_size_, padding_, type_face_);
+
+	formatted_lines_.erase(std::begin(formatted_lines_) + line_off, std::end(formatted_lines_));
+	std::move(std::begin(formatted_lines), std::end(formatted_lines),
+		std::back_inserter(formatted_lines_));
 }
 
 void Text::PrependContent(std::string_view content)
@@ -486,6 +607,20 @@ void Text::PrependContent(std::string_view content)
 		Content(std::string{content});
 		return;
 	}
+	else if (content.find_first_not_of('\n') == std::string_view::npos)
+	{
+		//Newline only content requires no parsing or reflow
+		//Each prepended newline flushes one empty line ahead of the existing first line,
+		//so the line count always equals the newline count
+		content_.insert(0, content);
+		formatted_blocks_.insert(std::begin(formatted_blocks_), std::size(content), {{}, "\n", true});
+
+		if (type_face_)
+			formatted_lines_.insert(std::begin(formatted_lines_), std::size(content),
+				{{}, true, graphics::utilities::vector2::Zero});
+
+		return;
+	}
 	else if (content.back() == '\n')
 	{
 		content.remove_suffix(1);
@@ -517,7 +652,11 @@ void Text::AppendLine(std::string_view content)
 		return;
 	}
 
-	content_ += "\n" + std::string{content};
+	//Append in-place, avoiding a temporary string allocation
+	content_.reserve(std::size(content_) + std::size(content) + 1);
+	content_ += '\n';
+	content_.append(content);
+
 	auto formatted_blocks = MakeFormattedBlocks(content);
 	auto formatted_lines = MakeFormattedLines(formatted_blocks, area_size_, padding_, type_face_);
 	formatted_blocks.insert(std::begin(formatted_blocks), {{}, "\n", true});
@@ -536,7 +675,11 @@ void Text::PrependLine(std::string_view content)
 		return;
 	}
 
-	content_.insert(0, std::string{content} + "\n");
+	//Prepend in-place, avoiding a temporary string allocation
+	content_.reserve(std::size(content_) + std::size(content) + 1);
+	content_.insert(0, 1, '\n');
+	content_.insert(0, content);
+
 	auto formatted_blocks = MakeFormattedBlocks(content);
 	auto formatted_lines = MakeFormattedLines(formatted_blocks, area_size_, padding_, type_face_);
 	formatted_blocks.push_back({{}, "\n", true});
@@ -561,7 +704,12 @@ void Text::InsertLine(int line_off, std::string_view content)
 	}
 
 	if (auto off = detail::get_content_offset(line_off, content_, formatting_); off < std::size(content_))
-		content_.insert(off, std::string{content} + "\n");
+	{
+		//Insert in-place, avoiding a temporary string allocation
+		content_.reserve(std::size(content_) + std::size(content) + 1);
+		content_.insert(off, 1, '\n');
+		content_.insert(off, content);
+	}
 	else
 	{
 		AppendLine(content);
@@ -620,9 +768,15 @@ void Text::RemoveLines(int first_line, int last_line)
 
 void Text::Clear() noexcept
 {
+	//Keeps capacity, clearing and refilling a text is a common (hot) pattern
 	content_.clear();
 	formatted_blocks_.clear();
 	formatted_lines_.clear();
+}
+
+void Text::ClearAndShrink() noexcept
+{
+	Clear();
 
 	content_.shrink_to_fit();
 	formatted_blocks_.shrink_to_fit();
@@ -644,13 +798,25 @@ std::string Text::UnformattedWrappedContent() const
 	//One or more lines to display
 	if (!std::empty(formatted_lines_))
 	{
+		//Sum up the total size, then append into a single allocation
+		auto size = std::size(formatted_lines_) - 1;
+
+		for (auto &line : formatted_lines_)
+			size += utilities::detail::text_blocks_to_string_size(line.Blocks);
+
+		std::string content;
+		content.reserve(size);
+
 		//First
-		auto content = utilities::detail::text_blocks_to_string(formatted_lines_.front().Blocks);
+		utilities::detail::text_blocks_to_string_into(content, formatted_lines_.front().Blocks);
 
 		//Rest
 		for (auto iter = std::begin(formatted_lines_) + 1,
 			end = std::end(formatted_lines_); iter != end; ++iter)
-			content += "\n" + utilities::detail::text_blocks_to_string(iter->Blocks);
+		{
+			content += '\n';
+			utilities::detail::text_blocks_to_string_into(content, iter->Blocks);
+		}
 
 		return content;
 	}
@@ -684,12 +850,24 @@ std::string Text::UnformattedDisplayedContent() const
 		auto iter = std::begin(formatted_lines_) + from_line_;
 		auto end = iter + max_lines;
 
+		//Sum up the total size, then append into a single allocation
+		auto size = static_cast<size_t>(max_lines) - 1;
+
+		for (auto it = iter; it != end; ++it)
+			size += utilities::detail::text_blocks_to_string_size(it->Blocks);
+
+		std::string content;
+		content.reserve(size);
+
 		//First
-		auto content = utilities::detail::text_blocks_to_string(iter->Blocks);
+		utilities::detail::text_blocks_to_string_into(content, iter->Blocks);
 
 		//Rest
 		for (++iter; iter != end; ++iter)
-			content += "\n" + utilities::detail::text_blocks_to_string(iter->Blocks);
+		{
+			content += '\n';
+			utilities::detail::text_blocks_to_string_into(content, iter->Blocks);
+		}
 
 		return content;
 	}
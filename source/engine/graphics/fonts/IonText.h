@@ -177,6 +177,9 @@ namespace ion::graphics::fonts
 			TextBlocks html_to_formatted_blocks(std::string_view content);
 			TextLines formatted_blocks_to_formatted_lines(TextBlocks text_blocks, TextOverflow overflow,
 				const std::optional<Vector2> &area_size, const Vector2 &padding, TypeFace &type_face);
+			void formatted_blocks_to_formatted_lines(TextBlocks text_blocks, TextOverflow overflow,
+				const std::optional<Vector2> &area_size, const Vector2 &padding, TypeFace &type_face,
+				TextLines &text_lines);
 
 			int get_character_count(const TextBlocks &text_blocks) noexcept;
 
@@ -185,6 +188,8 @@ namespace ion::graphics::fonts
 			size_t get_content_offset(int line_off, std::string_view content, TextFormatting formatting) noexcept;
 			size_t get_formatted_blocks_offset(int line_off, const TextBlocks &text_blocks) noexcept;
 			size_t get_formatted_lines_offset(int line_off, const TextLines &text_lines) noexcept;
+			size_t last_paragraph_blocks_offset(const TextBlocks &text_blocks) noexcept;
+			size_t last_paragraph_lines_offset(const TextLines &text_lines) noexcept;
 			int get_line_offset(size_t content_off, std::string_view content, TextFormatting formatting) noexcept;
 		} //detail
 	} //text
@@ -218,11 +223,20 @@ namespace ion::graphics::fonts
 			text::TextBlocks formatted_blocks_;
 			text::TextLines formatted_lines_;
 
+			bool deferred_update_ = false;
+			bool dirty_blocks_ = false;
+			bool dirty_lines_ = false;
+
 
 			text::TextBlocks MakeFormattedBlocks(std::string_view content) const;
 			text::TextLines MakeFormattedLines(text::TextBlocks text_blocks,
 				const std::optional<Vector2> &area_size, const Vector2 &padding,
 				NonOwningPtr<TypeFace> type_face) const;
+			void MakeFormattedLines(text::TextBlocks text_blocks,
+				const std::optional<Vector2> &area_size, const Vector2 &padding,
+				NonOwningPtr<TypeFace> type_face, text::TextLines &text_lines) const;
+
+			void RebuildFormatting(bool rebuild_blocks);
 
 		public:
 
@@ -259,6 +273,15 @@ namespace ion::graphics::fonts
 				@{
 			*/
 
+			///@brief Begins a deferred update, postponing all reformatting until EndUpdate is called
+			///@details Use this when changing multiple properties in sequence,
+			///to reformat the text once instead of once per changed property
+			void BeginUpdate() noexcept;
+
+			///@brief Ends a deferred update, and reformats the text if any changes have been made since BeginUpdate
+			void EndUpdate();
+
+
 			///@brief Sets the (raw) content to the given content
 			///@details Content can contain HTML tags and CSS code
 			void Content(std::string content);
@@ -543,8 +566,14 @@ namespace ion::graphics::fonts
 
 
 			///@brief Clears all content in this text
+			///@details The underlying storage is kept, so that clearing and refilling
+			///the text repeatedly does not reallocate.
+			///Use ClearAndShrink to also reclaim the memory
 			void Clear() noexcept;
 
+			///@brief Clears all content in this text and reclaims the underlying storage
+			void ClearAndShrink() noexcept;
+
 			///@}
 
 			/**
@@ -596,7 +596,21 @@ text::TextBlocks html_to_text_blocks(std::string_view str)
 
 	std::string content;
 
-	for (auto iter = std::begin(str), end = std::end(str); iter != end; ++iter)
+	//Everything before the first tag or new line is plain content,
+	//so the per-character state machine can skip that whole prefix
+	auto first_special = str.find_first_of("<\n");
+
+	if (first_special == std::string_view::npos)
+	{
+		if (!std::empty(str))
+			append_text_block(std::string{str}, text_blocks, text_block_styles);
+
+		return text_blocks;
+	}
+	else
+		content.append(str.substr(0, first_special));
+
+	for (auto iter = std::begin(str) + first_special, end = std::end(str); iter != end; ++iter)
 	{
 		auto c = *iter;
 		auto next_c = iter + 1 != end ? *(iter + 1) : '\0';
@@ -680,6 +694,22 @@ text::TextBlocks html_to_text_blocks(std::string_view str)
 text::TextLines text_blocks_to_text_lines(text::TextBlocks text_blocks)
 {
 	text::TextLines lines;
+	text_blocks_to_text_lines(std::move(text_blocks), lines);
+	return lines;
+}
+
+void text_blocks_to_text_lines(text::TextBlocks text_blocks, text::TextLines &lines)
+{
+	lines.clear(); //Keeps capacity
+
+	//The final line count is known up front,
+	//one line per new line character plus the tail line
+	auto line_count = size_t{1};
+
+	for (auto &text_block : text_blocks)
+		line_count += std::count(std::begin(text_block.Content), std::end(text_block.Content), '\n');
+
+	lines.reserve(line_count);
 	text::TextBlocks line_text_blocks;
 
 	for (auto &text_block : text_blocks)
@@ -712,18 +742,30 @@ text::TextLines text_blocks_to_text_lines(text::TextBlocks text_blocks)
 
 	if (!std::empty(line_text_blocks))
 		lines.push_back({std::move(line_text_blocks), true});
-
-	return lines;
 }
 
 std::string text_blocks_to_string(const text::TextBlocks &text_blocks)
 {
 	std::string str;
+	str.reserve(text_blocks_to_string_size(text_blocks));
+	text_blocks_to_string_into(str, text_blocks);
+	return str;
+}
+
+size_t text_blocks_to_string_size(const text::TextBlocks &text_blocks) noexcept
+{
+	auto size = size_t{0};
 
 	for (auto &text_block : text_blocks)
-		str += text_block.Content;
+		size += std::size(text_block.Content);
 
-	return str;
+	return size;
+}
+
+void text_blocks_to_string_into(std::string &str, const text::TextBlocks &text_blocks)
+{
+	for (auto &text_block : text_blocks)
+		str += text_block.Content;
 }
 
 
@@ -1133,6 +1175,11 @@ text::TextLines SplitTextBlocks(text::TextBlocks text_blocks)
 	return detail::text_blocks_to_text_lines(std::move(text_blocks));
 }
 
+void SplitTextBlocks(text::TextBlocks text_blocks, text::TextLines &text_lines)
+{
+	detail::text_blocks_to_text_lines(std::move(text_blocks), text_lines);
+}
+
 
 /*
 	Measuring
@@ -219,7 +219,10 @@ namespace ion::graphics::fonts::utilities
 
 		text::TextBlocks html_to_text_blocks(std::string_view str);
 		text::TextLines text_blocks_to_text_lines(text::TextBlocks text_blocks);
+		void text_blocks_to_text_lines(text::TextBlocks text_blocks, text::TextLines &lines);
 		std::string text_blocks_to_string(const text::TextBlocks &text_blocks);
+		size_t text_blocks_to_string_size(const text::TextBlocks &text_blocks) noexcept;
+		void text_blocks_to_string_into(std::string &str, const text::TextBlocks &text_blocks);
 
 		///@}
 
@@ -427,6 +430,9 @@ namespace ion::graphics::fonts::utilities
 	///@brief Returns text lines, by splitting up text blocks into lines when a '\\n' character is found
 	[[nodiscard]] text::TextLines SplitTextBlocks(text::TextBlocks text_blocks);
 
+	///@brief Splits the given text blocks into the given text lines, reusing its capacity
+	void SplitTextBlocks(text::TextBlocks text_blocks, text::TextLines &text_lines);
+
 	///@}
 
 	/**
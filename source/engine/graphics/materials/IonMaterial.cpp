@@ -14,7 +14,6 @@ File:	IonMaterial.cpp
 
 #include "graphics/textures/IonAnimation.h"
 #include "graphics/textures/IonTexture.h"
-#include "types/IonTypeTraits.h"
 #include "utilities/IonMath.h"
 
 namespace ion::graphics::materials
@@ -37,27 +36,13 @@ std::pair<Vector2, Vector2> get_tex_coords(const Vector2 &lower_left, const Vect
 	auto [new_ll_s, new_ll_t] = new_lower_left.XY();
 	auto [new_ur_s, new_ur_t] = new_upper_right.XY();
 
-	if (is_flipped_horizontally(lower_left, upper_right))
-		std::swap(new_ll_s, new_ur_s);
+	//Plain conditional selects (not swaps under branches), so the compiler
+	//can lower the flips to branch-free moves
+	auto flipped_h = is_flipped_horizontally(lower_left, upper_right);
+	auto flipped_v = is_flipped_vertically(lower_left, upper_right);
 
-	if (is_flipped_vertically(lower_left, upper_right))
-		std::swap(new_ll_t, new_ur_t);
-
-	return {{new_ll_s, new_ll_t}, {new_ur_s, new_ur_t}};
-}
-
-std::pair<Vector2, Vector2> get_unflipped_tex_coords(const Vector2 &lower_left, const Vector2 &upper_right) noexcept
-{
-	auto [ll_s, ll_t] = lower_left.XY();
-	auto [ur_s, ur_t] = upper_right.XY();
-
-	if (is_flipped_horizontally(lower_left, upper_right))
-		std::swap(ll_s, ur_s);
-
-	if (is_flipped_vertically(lower_left, upper_right))
-		std::swap(ll_t, ur_t);
-
-	return {{ll_s, ll_t}, {ur_s, ur_t}};
+	return {{flipped_h ? new_ur_s : new_ll_s, flipped_v ? new_ur_t : new_ll_t},
+			{flipped_h ? new_ll_s : new_ur_s, flipped_v ? new_ll_t : new_ur_t}};
 }
 
 
@@ -88,15 +73,19 @@ std::pair<Vector2, Vector2> get_normalized_tex_coords(const Vector2 &lower_left,
 	Texture map
 */
 
-std::pair<NonOwningPtr<Animation>, NonOwningPtr<Texture>> get_texture_maps(const texture_map_type &texture_map) noexcept
+NonOwningPtr<Texture> get_texture_map_at(const texture_map_type &texture_map, duration time) noexcept
 {
-	using pair_type = std::pair<NonOwningPtr<Animation>, NonOwningPtr<Texture>>;
-
-	return std::visit(types::overloaded{
-		[](std::monostate) { return pair_type{nullptr, nullptr}; },
-		[](NonOwningPtr<Animation> animation) { return pair_type{animation, nullptr}; },
-		[](NonOwningPtr<Texture> texture) { return pair_type{nullptr, texture}; }
-	}, texture_map);
+	if (auto [animation, texture] = get_texture_maps(texture_map); animation)
+	{
+		if (animation->Owner())
+			return animation->FrameAt(time);
+		else
+			return animation->CurrentFrame();
+	}
+	else if (texture)
+		return texture;
+	else
+		return nullptr;
 }
 
 NonOwningPtr<Texture> get_texture_map(const texture_map_type &texture_map) noexcept
@@ -278,62 +267,30 @@ Material::Material(std::string name, NonOwningPtr<Texture> diffuse_map,
 
 NonOwningPtr<Texture> Material::DiffuseMap(duration time) const noexcept
 {
-	if (auto [animation, texture] = DiffuseMap(); animation)
-	{
-		if (animation->Owner())
-			return animation->FrameAt(time);
-		else
-			return animation->CurrentFrame();
-	}
-	else if (texture)
-		return texture;
-	else
-		return nullptr;
+	return detail::get_texture_map_at(diffuse_map_, time);
 }
 
 NonOwningPtr<Texture> Material::NormalMap(duration time) const noexcept
 {
-	if (auto [animation, texture] = NormalMap(); animation)
-	{
-		if (animation->Owner())
-			return animation->FrameAt(time);
-		else
-			return animation->CurrentFrame();
-	}
-	else if (texture)
-		return texture;
-	else
-		return nullptr;
+	return detail::get_texture_map_at(normal_map_, time);
 }
 
 NonOwningPtr<Texture> Material::SpecularMap(duration time) const noexcept
 {
-	if (auto [animation, texture] = SpecularMap(); animation)
-	{
-		if (animation->Owner())
-			return animation->FrameAt(time);
-		else
-			return animation->CurrentFrame();
-	}
-	else if (texture)
-		return texture;
-	else
-		return nullptr;
+	return detail::get_texture_map_at(specular_map_, time);
 }
 
 NonOwningPtr<Texture> Material::EmissiveMap(duration time) const noexcept
 {
-	if (auto [animation, texture] = EmissiveMap(); animation)
-	{
-		if (animation->Owner())
-			return animation->FrameAt(time);
-		else
-			return animation->CurrentFrame();
-	}
-	else if (texture)
-		return texture;
-	else
-		return nullptr;
+	return detail::get_texture_map_at(emissive_map_, time);
+}
+
+material::TextureMaps Material::GetTextureMaps(duration time) const noexcept
+{
+	return {detail::get_texture_map_at(diffuse_map_, time),
+			detail::get_texture_map_at(normal_map_, time),
+			detail::get_texture_map_at(specular_map_, time),
+			detail::get_texture_map_at(emissive_map_, time)};
 }
 
 
@@ -414,20 +371,6 @@ void Material::FlipVertical() noexcept
 }
 
 
-bool Material::IsCropped() const noexcept
-{
-	auto [lower_left, upper_right] =
-		detail::get_unflipped_tex_coords(lower_left_tex_coord_, upper_right_tex_coord_);
-	return detail::is_cropped(lower_left, upper_right);
-}
-
-bool Material::IsRepeated() const noexcept
-{
-	auto [lower_left, upper_right] =
-		detail::get_unflipped_tex_coords(lower_left_tex_coord_, upper_right_tex_coord_);
-	return detail::is_repeated(lower_left, upper_right);
-}
-
 std::pair<bool, bool> Material::IsRepeatable() const noexcept
 {
 	if (auto texture = detail::get_first_texture_map(diffuse_map_, normal_map_, specular_map_, emissive_map_); texture)
@@ -441,16 +384,6 @@ std::pair<bool, bool> Material::IsRepeatable() const noexcept
 }
 
 
-bool Material::IsFlippedHorizontally() const noexcept
-{
-	return detail::is_flipped_horizontally(lower_left_tex_coord_, upper_right_tex_coord_);
-}
-
-bool Material::IsFlippedVertically() const noexcept
-{
-	return detail::is_flipped_vertically(lower_left_tex_coord_, upper_right_tex_coord_);
-}
-
 
 std::pair<Vector2, Vector2> Material::WorldTexCoords() const noexcept
 {
@@ -492,4 +425,47 @@ std::pair<Vector2, Vector2> Material::WorldTexCoords() const noexcept
 	return {lower_left_tex_coord_, upper_right_tex_coord_};
 }
 
+material::TexCoordsInfo Material::GetTexCoordsInfo() const noexcept
+{
+	if (auto texture = detail::get_first_texture_map(diffuse_map_, normal_map_, specular_map_, emissive_map_); texture)
+	{
+		auto [lower_left, upper_right] =
+			detail::get_unflipped_tex_coords(lower_left_tex_coord_, upper_right_tex_coord_);
+		auto [s_repeatable, t_repeatable] =
+			detail::is_texture_map_repeatable(*texture, lower_left, upper_right);
+
+		//Use local tex coords relative to world tex coords
+		if (auto world_tex_coords = texture->TexCoords(); world_tex_coords)
+		{
+			auto &[world_lower_left, world_upper_right] = *world_tex_coords;
+
+			//Discard any repetition on s
+			if (!s_repeatable)
+			{
+				lower_left.X(std::max(lower_left.X(), 0.0_r));
+				upper_right.X(std::min(upper_right.X(), 1.0_r));
+			}
+
+			//Discard any repetition on t
+			if (!t_repeatable)
+			{
+				lower_left.Y(std::max(lower_left.Y(), 0.0_r));
+				upper_right.Y(std::min(upper_right.Y(), 1.0_r));
+			}
+
+			auto [norm_lower_left, norm_upper_right] =
+				detail::get_normalized_tex_coords(lower_left, upper_right, world_lower_left, world_upper_right);
+
+			return {detail::get_tex_coords(lower_left_tex_coord_, upper_right_tex_coord_,
+										   norm_lower_left, norm_upper_right),
+					{s_repeatable, t_repeatable}};
+		}
+		else //Use local tex coords
+			return {{lower_left_tex_coord_, upper_right_tex_coord_}, {s_repeatable, t_repeatable}};
+	}
+
+	//Use local tex coords
+	return {{lower_left_tex_coord_, upper_right_tex_coord_}, {false, false}};
+}
+
 } //ion::graphics::materials
\ No newline at end of file
@@ -90,7 +90,21 @@ namespace ion::graphics::materials
 
 		std::pair<Vector2, Vector2> get_tex_coords(const Vector2 &lower_left, const Vector2 &upper_right,
 			const Vector2 &new_lower_left, const Vector2 &new_upper_right) noexcept;
-		std::pair<Vector2, Vector2> get_unflipped_tex_coords(const Vector2 &lower_left, const Vector2 &upper_right) noexcept;
+
+		inline auto get_unflipped_tex_coords(const Vector2 &lower_left, const Vector2 &upper_right) noexcept
+			-> std::pair<Vector2, Vector2>
+		{
+			auto [ll_s, ll_t] = lower_left.XY();
+			auto [ur_s, ur_t] = upper_right.XY();
+
+			if (is_flipped_horizontally(lower_left, upper_right))
+				std::swap(ll_s, ur_s);
+
+			if (is_flipped_vertically(lower_left, upper_right))
+				std::swap(ll_t, ur_t);
+
+			return {{ll_s, ll_t}, {ur_s, ur_t}};
+		}
 
 		Vector2 get_normalized_tex_coord(const Vector2 &tex_coord, const Vector2 &min, const Vector2 &max,
 			const Vector2 &new_min, const Vector2 &new_max) noexcept;
@@ -104,23 +118,62 @@ namespace ion::graphics::materials
 			@{
 		*/
 
-		std::pair<NonOwningPtr<Animation>, NonOwningPtr<Texture>> get_texture_maps(const texture_map_type &texture_map) noexcept;
+		///@brief Returns the animation and texture stored in the given texture map
+		///@details Dispatches on the variant index directly (no std::visit machinery),
+		///so the frequently called map observers below inline down to a check and a load
+		inline auto get_texture_maps(const texture_map_type &texture_map) noexcept
+			-> std::pair<NonOwningPtr<Animation>, NonOwningPtr<Texture>>
+		{
+			if (auto animation = std::get_if<NonOwningPtr<Animation>>(&texture_map); animation)
+				return {*animation, nullptr};
+			else if (auto texture = std::get_if<NonOwningPtr<Texture>>(&texture_map); texture)
+				return {nullptr, *texture};
+			else
+				return {nullptr, nullptr};
+		}
+
 		NonOwningPtr<Texture> get_texture_map(const texture_map_type &texture_map) noexcept;
 		NonOwningPtr<Texture> get_first_texture_map(const texture_map_type &diffuse_map, const texture_map_type &normal_map,
 			const texture_map_type &specular_map, const texture_map_type &emissive_map) noexcept;
 
+		NonOwningPtr<Texture> get_texture_map_at(const texture_map_type &texture_map, duration time) noexcept;
+
 		std::pair<bool, bool> is_texture_map_repeatable(const Texture &texture,
 			const Vector2 &lower_left, const Vector2 &upper_right) noexcept;
 
 		///@}
 	} //material::detail
 
+	namespace material
+	{
+		///@brief A structure containing all texture maps of a material, resolved at a given time
+		///@details The render path fetches all maps together when binding a material
+		struct TextureMaps final
+		{
+			NonOwningPtr<Texture> DiffuseMap;
+			NonOwningPtr<Texture> NormalMap;
+			NonOwningPtr<Texture> SpecularMap;
+			NonOwningPtr<Texture> EmissiveMap;
+		};
+
+		///@brief A structure containing the world tex coords and repeatability of a material
+		///@details The tex coord generation path fetches both together,
+		///so the first texture map only needs to be resolved once
+		struct TexCoordsInfo final
+		{
+			std::pair<Vector2, Vector2> WorldTexCoords;
+			std::pair<bool, bool> Repeatable;
+		};
+	} //material
+
 
 	///@brief A class representing a material with ambient, diffuse, specular, emissive and shininess properties
 	class Material final : public managed::ManagedObject<MaterialManager>
 	{
 		private:
 
+			//Hot block, the colors and shininess are read together every material bind
+			//and deliberately laid out first and contiguously, ahead of the colder maps
 			Color ambient_color_ = color::White;
 			Color diffuse_color_ = color::White;
 			Color specular_color_ = color::DarkGray;
@@ -421,6 +474,10 @@ namespace ion::graphics::materials
 			///@details Returns nullptr if no emissive map is in use
 			[[nodiscard]] NonOwningPtr<Texture> EmissiveMap(duration time) const noexcept;
 
+			///@brief Returns all attached map textures at the given time in a single query
+			///@details Returns nullptr for each map not in use
+			[[nodiscard]] material::TextureMaps GetTextureMaps(duration time) const noexcept;
+
 
 			///@brief Returns the lower left and upper right texture coordinates for this material
 			[[nodiscard]] inline auto TexCoords() const noexcept
@@ -472,10 +529,20 @@ namespace ion::graphics::materials
 
 
 			///@brief Returns true if this materials texture maps are cropped
-			[[nodiscard]] bool IsCropped() const noexcept;
+			[[nodiscard]] inline auto IsCropped() const noexcept
+			{
+				auto [lower_left, upper_right] =
+					material::detail::get_unflipped_tex_coords(lower_left_tex_coord_, upper_right_tex_coord_);
+				return material::detail::is_cropped(lower_left, upper_right);
+			}
 
 			///@brief Returns true if this materials texture maps are repeated
-			[[nodiscard]] bool IsRepeated() const noexcept;
+			[[nodiscard]] inline auto IsRepeated() const noexcept
+			{
+				auto [lower_left, upper_right] =
+					material::detail::get_unflipped_tex_coords(lower_left_tex_coord_, upper_right_tex_coord_);
+				return material::detail::is_repeated(lower_left, upper_right);
+			}
 
 			///@brief Returns a pair of true/false to indicate which texture maps axis for this material is repeatable
 			///@details For animations, repeatability is only retrieved from the first frame
@@ -483,10 +550,16 @@ namespace ion::graphics::materials
 
 
 			///@brief Returns true if this materials texture maps are flipped horizontally
-			[[nodiscard]] bool IsFlippedHorizontally() const noexcept;
+			[[nodiscard]] inline auto IsFlippedHorizontally() const noexcept
+			{
+				return material::detail::is_flipped_horizontally(lower_left_tex_coord_, upper_right_tex_coord_);
+			}
 
 			///@brief Returns true if this materials texture maps are flipped vertically
-			[[nodiscard]] bool IsFlippedVertically() const noexcept;
+			[[nodiscard]] inline auto IsFlippedVertically() const noexcept
+			{
+				return material::detail::is_flipped_vertically(lower_left_tex_coord_, upper_right_tex_coord_);
+			}
 
 
 			///@brief Returns the lower left and upper right texture coordinates for this material
@@ -494,6 +567,11 @@ namespace ion::graphics::materials
 			///For animations, tex coords are only retrieved from the first frame
 			[[nodiscard]] std::pair<Vector2, Vector2> WorldTexCoords() const noexcept;
 
+			///@brief Returns both the world tex coords and the repeatability for this material
+			///@details Equivalent to calling WorldTexCoords and IsRepeatable,
+			///but the first texture map is only resolved once
+			[[nodiscard]] material::TexCoordsInfo GetTexCoordsInfo() const noexcept;
+
 			///@}
 	};
 } //ion::graphics::materials
@@ -176,13 +176,15 @@ void Emitter::Elapse(duration time) noexcept
 		}
 	}
 
-	//Evolve particles (even when not emitting)
+	//Evolve and affect particles (even when not emitting)
+	//With no active particles each affector pass is a no-op, so skip the loop entirely
 	if (!std::empty(particles_))
+	{
 		detail::evolve_particles(particles_, time);
 
-	//Affect particles (even when not emitting)
-	for (auto &affector : Affectors())
-		affector.Affect(Particles(), time);
+		for (auto &affector : Affectors())
+			affector.Affect(Particles(), time);
+	}
 }
 
 
@@ -192,9 +194,14 @@ void Emitter::Elapse(duration time) noexcept
 
 void Emitter::Emit(int particle_count) noexcept
 {
-	for (particle_count = std::min(particle_count, particle_quota_ - std::ssize(particles_));
-		particle_count > 0; --particle_count)
+	particle_count = std::min(particle_count, particle_quota_ - std::ssize(particles_));
+
+	if (particle_count > 0)
+		particles_.reserve(std::size(particles_) + particle_count);
+			//Reserve the whole burst up front (bounded by the quota),
+			//so emitting does not reallocate particle by particle
 
+	for (; particle_count > 0; --particle_count)
 		particles_.emplace_back(
 			position_ + detail::particle_position(type_, size_ * 0.5_r, inner_size_ * 0.5_r), //Position
 			detail::particle_direction(direction_, emission_angle_, particle_velocity_.first, particle_velocity_.second), //Direction + velocity
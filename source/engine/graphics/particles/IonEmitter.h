@@ -181,6 +181,8 @@ namespace ion::graphics::particles
 			Cumulative<real> emission_amount_{1.0_r};
 
 			emitter::detail::container_type<Particle> particles_;
+				//Interleaved (AoS) by design, the particle layout doubles as
+				//the vertex format streamed directly to the GPU when drawing
 
 
 			//Initial spawn values for each new particle, in range [first, second]
@@ -100,8 +100,12 @@ void ParticleSystem::Elapse(duration time) noexcept
 		emitter.Elapse(time);
 
 		//Affect particles (in emitter)
-		for (auto &affector : Affectors())
-			affector.Affect(emitter.Particles(), time);
+		//With no active particles each affector pass is a no-op, so skip the loop entirely
+		if (emitter.HasActiveParticles())
+		{
+			for (auto &affector : Affectors())
+				affector.Affect(emitter.Particles(), time);
+		}
 	}
 }
 
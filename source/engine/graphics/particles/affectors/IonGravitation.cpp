@@ -26,6 +26,9 @@ namespace gravitation::detail
 void affect_particles(affector::detail::particle_range particles, duration time,
 					  const Vector2 &position, real gravity, real mass) noexcept
 {
+	auto scaled_gravity = gravity * mass * time.count();
+		//Loop invariant, only the particle mass and distance vary per particle
+
 	for (auto &particle : particles)
 	{
 		//Newton's law of universal gravitation
@@ -34,8 +37,8 @@ void affect_particles(affector::detail::particle_range particles, duration time,
 
 		if (length > 0.0_r)
 		{
-			auto force = gravity * mass * particle.Mass() / length;
-			particle.Direction(particle.Direction() + distance * force * time.count());
+			auto force = scaled_gravity * particle.Mass() / length;
+			particle.Direction(particle.Direction() + distance * force);
 		}
 	}
 }
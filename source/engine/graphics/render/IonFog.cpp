@@ -30,7 +30,7 @@ Fog::Fog(FogMode mode, real density, real near_distance, real far_distance, cons
 	far_distance_{far_distance},
 	color_{color}
 {
-	//Empty
+	UpdateScale();
 }
 
 
@@ -50,8 +50,16 @@ namespace ion::graphics::render
 			real density_ = 1.0_r;
 			real near_distance_ = 0.0_r; //Start
 			real far_distance_ = 1.0_r; //End
+			real scale_ = 1.0_r; //Cached, only changes with the distances
 			Color color_ = fog::detail::default_color;
 
+
+			inline void UpdateScale() noexcept
+			{
+				assert(far_distance_ - near_distance_ != 0.0_r);
+				scale_ = 1.0_r / (far_distance_ - near_distance_);
+			}
+
 		public:
 
 			///@brief Default constructor
@@ -103,12 +111,14 @@ namespace ion::graphics::render
 			inline void NearDistance(real near_distance) noexcept
 			{
 				near_distance_ = near_distance;
+				UpdateScale();
 			}
 
 			///@brief Sets the far distance (end) of this fog to the given value
 			inline void FarDistance(real far_distance) noexcept
 			{
 				far_distance_ = far_distance;
+				UpdateScale();
 			}
 
 			///@brief Sets the tint of this fog to the given color
@@ -156,11 +166,11 @@ namespace ion::graphics::render
 
 
 			///@brief Returns the scale factor of this fog
-			///@details Scale only applies if the fog mode is linear
+			///@details Scale only applies if the fog mode is linear.
+			///The scale is cached when the distances change, so this is a plain load
 			[[nodiscard]] inline auto Scale() const noexcept
 			{
-				assert(far_distance_ - near_distance_ != 0.0_r);
-				return 1.0_r / (far_distance_ - near_distance_);
+				return scale_;
 			}
 
 			///@}
@@ -120,9 +120,9 @@ int render_pass_blend_equation_mode_to_gl_blend_equation_mode(BlendEquationMode
 
 void blend(BlendFactor source_factor, BlendFactor destination_factor, BlendEquationMode equation_mode) noexcept
 {
-	glBlendFunc(render_pass_blend_factor_to_gl_blend_factor(source_factor), render_pass_blend_factor_to_gl_blend_factor(destination_factor));
+	gl::BlendFunc(render_pass_blend_factor_to_gl_blend_factor(source_factor), render_pass_blend_factor_to_gl_blend_factor(destination_factor));
 	glBlendEquation(render_pass_blend_equation_mode_to_gl_blend_equation_mode(equation_mode));
-	glEnable(GL_BLEND);
+	gl::Enable(GL_BLEND);
 }
 
 void blend_separate(BlendFactor source_factor, BlendFactor destination_factor,
@@ -149,6 +149,9 @@ void blend_separate(BlendFactor source_factor, BlendFactor destination_factor,
 		}
 	}
 
+	gl::detail::state.blend_func = {};
+		//The separate blend funcs above bypass the cached (non-separate) blend func
+
 	switch (gl::BlendEquationSeparate_Support())
 	{
 		case gl::Extension::Core:
@@ -162,7 +165,7 @@ void blend_separate(BlendFactor source_factor, BlendFactor destination_factor,
 		break;
 	}
 
-	glEnable(GL_BLEND);
+	gl::Enable(GL_BLEND);
 }
 
 } //render_pass::detail
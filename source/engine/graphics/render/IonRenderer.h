@@ -122,6 +122,8 @@ namespace ion::graphics::render
 
 			render_primitive::VertexContainer vertex_data_; //Data (RAM)
 			std::optional<vertex::VertexBufferObject> vbo_; //Stream buffer (VRAM)
+				//One shared buffer per renderer, each batch is a sub range (offset + capacity) into it
+				//Drawables should never allocate their own small buffers
 			bool need_update_ = true;
 
 
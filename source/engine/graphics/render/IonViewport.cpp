@@ -197,14 +197,14 @@ void render_to_viewport(const Vector2 &position, const Vector2 &size, const Colo
 
 	glViewport(gl_x, gl_y, gl_width, gl_height);
 	glScissor(gl_x, gl_y, gl_width, gl_height);
-	glEnable(GL_SCISSOR_TEST);
+	gl::Enable(GL_SCISSOR_TEST);
 
 	auto [r, g, b, a] = background_color.RGBA();
 	glClearDepth(1.0);
 	glClearColor(static_cast<float>(r), static_cast<float>(g), static_cast<float>(b), static_cast<float>(a));
 	glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-	glDisable(GL_SCISSOR_TEST);
+	gl::Disable(GL_SCISSOR_TEST);
 }
 
 } //viewport::detail
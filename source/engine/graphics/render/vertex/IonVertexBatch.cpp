@@ -291,25 +291,15 @@ void bind_texture(textures::texture::TextureHandle texture_handle) noexcept
 		}
 	}
 
-	glBindTexture(gl_texture_type, texture_handle.Id);
+	gl::BindTexture(gl_texture_type, texture_handle.Id);
 }
 
 void bind_texture(textures::texture::TextureHandle texture_handle, int texture_unit) noexcept
 {
 	auto gl_texture_type = textures::texture::detail::texture_type_to_gl_texture_type(texture_handle.Type);
 
-	switch (gl::MultiTexture_Support())
-	{
-		case gl::Extension::Core:
-		glActiveTexture(GL_TEXTURE0 + texture_unit);
-		break;
-
-		case gl::Extension::ARB:
-		glActiveTextureARB(GL_TEXTURE0_ARB + texture_unit);
-		break;
-	}
-
-	glBindTexture(gl_texture_type, texture_handle.Id);
+	gl::ActiveTexture(texture_unit);
+	gl::BindTexture(gl_texture_type, texture_handle.Id);
 }
 
 
@@ -373,10 +363,13 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 	auto normal_map_activated = false;
 	auto specular_map_activated = false;
 	auto emissive_map_activated = false;
+
+	auto texture_maps = material->GetTextureMaps(time);
+		//All maps are resolved in one query, instead of one variant visit per map
 	
 	if (auto diffuse_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_DiffuseMap); diffuse_map)
 	{
-		if (auto texture = material->DiffuseMap(time); texture && texture->Handle())
+		if (auto &texture = texture_maps.DiffuseMap; texture && texture->Handle())
 		{
 			if (auto texture_unit = diffuse_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
@@ -388,7 +381,7 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 	
 	if (auto normal_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_NormalMap); normal_map)
 	{
-		if (auto texture = material->NormalMap(time); texture && texture->Handle())
+		if (auto &texture = texture_maps.NormalMap; texture && texture->Handle())
 		{
 			if (auto texture_unit = normal_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
@@ -400,7 +393,7 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 
 	if (auto specular_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_SpecularMap); specular_map)
 	{
-		if (auto texture = material->SpecularMap(time); texture && texture->Handle())
+		if (auto &texture = texture_maps.SpecularMap; texture && texture->Handle())
 		{
 			if (auto texture_unit = specular_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
@@ -412,7 +405,7 @@ void set_material_uniforms(materials::Material *material, duration time, shaders
 
 	if (auto emissive_map = shader_program.GetUniform(shaders::shader_layout::UniformName::Material_EmissiveMap); emissive_map)
 	{
-		if (auto texture = material->EmissiveMap(time); texture && texture->Handle())
+		if (auto &texture = texture_maps.EmissiveMap; texture && texture->Handle())
 		{
 			if (auto texture_unit = emissive_map->Get<glsl::sampler2D>(); texture_unit >= 0)
 			{
@@ -667,6 +660,11 @@ void VertexBatch::Draw(shaders::ShaderProgram *shader_program) noexcept
 		vao_->Bind();
 
 	glDrawArrays(detail::vertex_draw_mode_to_gl_draw_mode(draw_mode_), 0, vertex_count_); //Draw
+		//Non-indexed on purpose, a batch concatenates the raw vertex data of many
+		//primitives of varying size (quads, ellipses, curves, text) into one stream
+		//An index buffer would have to be rebuilt with per-slot offsets every time
+		//a primitive is added, moved or resized, costing more than the duplicated
+		//vertices it would save (two per quad)
 
 	if (use_vao)
 		vao_->Unbind();
@@ -12,9 +12,6 @@ File:	IonCamera.cpp
 
 #include "IonCamera.h"
 
-#include <type_traits>
-
-#include "graphics/IonGraphicsAPI.h"
 #include "graphics/render/IonViewport.h"
 #include "graphics/scene/IonSceneManager.h"
 #include "graphics/scene/graph/IonSceneNode.h"
@@ -33,39 +30,47 @@ using graphics::render::Frustum;
 namespace camera::detail
 {
 
-void move_to(const Vector3 &position) noexcept
+Matrix4 get_view_matrix(const Vector3 &position, real angle) noexcept
 {
-	auto [x, y, z] = position.XYZ();
+	//Closed-form Rotation(angle).Transpose() * Translation(-position)
+	//A z-rotation plus translation only has four non-trivial entries,
+	//so fill them directly instead of doing a full 4x4 matrix multiplication
 
-	if constexpr (std::is_same_v<real, float>)
-		glTranslatef(static_cast<float>(-x), static_cast<float>(-y), static_cast<float>(-z));
-	else
-		glTranslated(static_cast<double>(-x), static_cast<double>(-y), static_cast<double>(-z));
-}
+	auto sin_of_angle = math::Sin(angle);
+	auto cos_of_angle = math::Cos(angle);
+	auto [x, y, z] = position.XYZ();
 
-void rotate_by(real angle) noexcept
-{
-	#ifdef ION_LEFT_HANDED
-	//Left-hand rotation CW
-	if constexpr (std::is_same_v<real, float>)
-		glRotatef(static_cast<float>(math::ToDegrees(angle)), 0.0f, 0.0f, 1.0f); //Rotate around the z-axis
-	else
-		glRotated(static_cast<double>(math::ToDegrees(angle)), 0.0, 0.0, 1.0); //Rotate around the z-axis
+	#ifdef ION_ROW_MAJOR
+	//Row-major layout (Direct3D)
+		#ifdef ION_LEFT_HANDED
+		//Left-hand rotation CW
+		return {cos_of_angle, sin_of_angle, 0.0_r,
+				-sin_of_angle, cos_of_angle, 0.0_r,
+				0.0_r, 0.0_r, 1.0_r,
+				sin_of_angle * y - cos_of_angle * x, -(sin_of_angle * x + cos_of_angle * y), -z};
+		#else
+		//Right-hand rotation CCW
+		return {cos_of_angle, -sin_of_angle, 0.0_r,
+				sin_of_angle, cos_of_angle, 0.0_r,
+				0.0_r, 0.0_r, 1.0_r,
+				-(cos_of_angle * x + sin_of_angle * y), sin_of_angle * x - cos_of_angle * y, -z};
+		#endif
 	#else
-	//Right-hand rotation CCW
-	if constexpr (std::is_same_v<real, float>)
-		glRotatef(static_cast<float>(-math::ToDegrees(angle)), 0.0f, 0.0f, 1.0f); //Rotate around the z-axis
-	else
-		glRotated(static_cast<double>(-math::ToDegrees(angle)), 0.0, 0.0, 1.0); //Rotate around the z-axis
+	//Column-major layout (OpenGL)
+		#ifdef ION_LEFT_HANDED
+		//Left-hand rotation CW
+		return {cos_of_angle, -sin_of_angle, 0.0_r, sin_of_angle * y - cos_of_angle * x,
+				sin_of_angle, cos_of_angle, 0.0_r, -(sin_of_angle * x + cos_of_angle * y),
+				0.0_r, 0.0_r, 1.0_r, -z};
+		#else
+		//Right-hand rotation CCW
+		return {cos_of_angle, sin_of_angle, 0.0_r, -(cos_of_angle * x + sin_of_angle * y),
+				-sin_of_angle, cos_of_angle, 0.0_r, sin_of_angle * x - cos_of_angle * y,
+				0.0_r, 0.0_r, 1.0_r, -z};
+		#endif
 	#endif
 }
 
-
-Matrix4 get_view_matrix(const Vector3 &position, real angle) noexcept
-{
-	return Matrix4::Rotation(angle).Transpose() * Matrix4::Translation(-position);
-}
-
 } //camera::detail
 
 
@@ -140,9 +145,9 @@ void Camera::CaptureScene(const render::Viewport &viewport) noexcept
 		rotation += parent_node->DerivedRotation();
 	}
 
-	detail::rotate_by(rotation);
-	detail::move_to(position);
 	view_matrix_ = detail::get_view_matrix(position, rotation);
+		//No glRotate/glTranslate calls here, the scene graph loads this
+		//view matrix directly onto the model view stack before drawing
 
 	if (update_bounding_volumes_)
 	{
@@ -40,9 +40,6 @@ namespace ion::graphics::scene
 	{
 		namespace detail
 		{
-			void move_to(const Vector3 &position) noexcept;
-			void rotate_by(real angle) noexcept;
-
 			Matrix4 get_view_matrix(const Vector3 &position, real angle) noexcept;
 		} //detail
 	} //camera
@@ -58,7 +58,7 @@ std::optional<light_texture> create_texture(int width, int depth) noexcept
 		textures::texture::TextureHandle{0, textures::texture::TextureType::ArrayTexture1D};
 
 	glGenTextures(1, reinterpret_cast<unsigned int*>(&texture_handle.Id));
-	glBindTexture(GL_TEXTURE_1D_ARRAY, texture_handle.Id);
+	gl::BindTexture(GL_TEXTURE_1D_ARRAY, texture_handle.Id);
 
 	glTexParameteri(GL_TEXTURE_1D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 	glTexParameteri(GL_TEXTURE_1D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
@@ -71,7 +71,7 @@ std::optional<light_texture> create_texture(int width, int depth) noexcept
 		GL_RGBA32F, width, depth,
 		0, GL_RGBA, type, nullptr);
 
-	glBindTexture(GL_TEXTURE_1D_ARRAY, 0);
+	gl::BindTexture(GL_TEXTURE_1D_ARRAY, 0);
 	return light_texture{texture_handle, width, depth};
 }
 
@@ -104,9 +104,13 @@ void upload_light_data(OwningPtr<light_texture> &texture,
 	if (texture && texture->handle)
 	{
 		constexpr auto type = std::is_same_v<real, float> ? GL_FLOAT : GL_DOUBLE;
+		constexpr auto row_components = light_texture_width * 4; //RGBA
 
 		light_texture_data light_data{};
-		glBindTexture(GL_TEXTURE_1D_ARRAY, texture->handle->Id);
+		texture->scratch_data.resize(std::size(lights) * row_components);
+
+		auto first_changed = static_cast<int>(std::ssize(lights));
+		auto last_changed = -1;
 
 		for (auto i = 0; auto &light : lights)
 		{
@@ -132,38 +136,19 @@ void upload_light_data(OwningPtr<light_texture> &texture,
 			auto [sx, sy] = light->ParentNode()->DerivedScaling().XY();
 			light_data[7] = light->Radius() * std::max(sx, sy);
 
-			{
-				auto [r, g, b, a] = light->AmbientColor().RGBA();
-				light_data[8] = r;
-				light_data[9] = g;
-				light_data[10] = b;
-				light_data[11] = a;
-			}
-
-			{
-				auto [r, g, b, a] = light->DiffuseColor().RGBA();
-				light_data[12] = r;
-				light_data[13] = g;
-				light_data[14] = b;
-				light_data[15] = a;
-			}
-
-			{
-				auto [r, g, b, a] = light->SpecularColor().RGBA();
-				light_data[16] = r;
-				light_data[17] = g;
-				light_data[18] = b;
-				light_data[19] = a;
-			}
+			//Ambient, diffuse and specular are stored contiguously in the light
+			//Copy all twelve channels in one go
+			std::memcpy(&light_data[8], std::data(light->Colors()), sizeof(light->Colors()));
 
 			auto [constant, linear, quadratic] = light->Attenuation();
 			light_data[20] = constant;
 			light_data[21] = linear;
 			light_data[22] = quadratic;
 
-			auto [cutoff_angle, outer_cutoff_angle] = light->Cutoff();
-			light_data[24] = math::Cos(cutoff_angle);
-			light_data[25] = math::Cos(outer_cutoff_angle);
+			auto [cutoff, outer_cutoff] = light->CutoffValues();
+			light_data[24] = cutoff;
+			light_data[25] = outer_cutoff;
+				//Already stored as cosines, no acos/cos round trip
 
 
 			//Light data has changed
@@ -171,17 +156,26 @@ void upload_light_data(OwningPtr<light_texture> &texture,
 				!texture_data.first || texture_data.second.layer != i ||
 				std::memcmp(std::data(texture_data.second.data), std::data(light_data), std::size(light_data) * sizeof(real)) != 0)
 			{
-				//Upload light data to gl texture
-				glTexSubImage2D(GL_TEXTURE_1D_ARRAY, 0,
-					0, i, texture->width, 1,
-					GL_RGBA, type, std::data(light_data));
+				first_changed = std::min(first_changed, i);
+				last_changed = i;
 				light->TextureData({texture, light_texture_storage{i, light_data}});
 			}
 
+			std::copy(std::begin(light_data), std::end(light_data),
+				std::begin(texture->scratch_data) + i * row_components);
 			++i;
 		}
 
-		glBindTexture(GL_TEXTURE_1D_ARRAY, 0);
+		//Upload all changed rows to gl texture with a single call,
+		//instead of one call per light
+		if (last_changed >= first_changed)
+		{
+			gl::BindTexture(GL_TEXTURE_1D_ARRAY, texture->handle->Id);
+			glTexSubImage2D(GL_TEXTURE_1D_ARRAY, 0,
+				0, first_changed, texture->width, last_changed - first_changed + 1,
+				GL_RGBA, type, std::data(texture->scratch_data) + first_changed * row_components);
+			gl::BindTexture(GL_TEXTURE_1D_ARRAY, 0);
+		}
 	}
 }
 
@@ -201,9 +195,13 @@ void upload_emissive_light_data(OwningPtr<light_texture> &texture,
 	if (texture && texture->handle)
 	{
 		constexpr auto type = std::is_same_v<real, float> ? GL_FLOAT : GL_DOUBLE;
+		constexpr auto row_components = emissive_light_texture_width * 4; //RGBA
 
 		emissive_light_texture_data light_data{};
-		glBindTexture(GL_TEXTURE_1D_ARRAY, texture->handle->Id);
+		texture->scratch_data.resize(std::size(lights) * row_components);
+
+		auto first_changed = static_cast<int>(std::ssize(lights));
+		auto last_changed = -1;
 
 		for (auto i = 0; auto &light : lights)
 		{
@@ -228,17 +226,26 @@ void upload_emissive_light_data(OwningPtr<light_texture> &texture,
 				!texture_data.first || texture_data.second.layer != i ||
 				std::memcmp(std::data(texture_data.second.data), std::data(light_data), std::size(light_data) * sizeof(real)) != 0)
 			{
-				//Upload light data to gl texture
-				glTexSubImage2D(GL_TEXTURE_1D_ARRAY, 0,
-					0, i, texture->width, 1,
-					GL_RGBA, type, std::data(light_data));
+				first_changed = std::min(first_changed, i);
+				last_changed = i;
 				light->TextureData({texture, light_texture_storage{i, light_data}});
 			}
 
+			std::copy(std::begin(light_data), std::end(light_data),
+				std::begin(texture->scratch_data) + i * row_components);
 			++i;
 		}
 
-		glBindTexture(GL_TEXTURE_1D_ARRAY, 0);
+		//Upload all changed rows to gl texture with a single call,
+		//instead of one call per light
+		if (last_changed >= first_changed)
+		{
+			gl::BindTexture(GL_TEXTURE_1D_ARRAY, texture->handle->Id);
+			glTexSubImage2D(GL_TEXTURE_1D_ARRAY, 0,
+				0, first_changed, texture->width, last_changed - first_changed + 1,
+				GL_RGBA, type, std::data(texture->scratch_data) + first_changed * row_components);
+			gl::BindTexture(GL_TEXTURE_1D_ARRAY, 0);
+		}
 	}
 }
 
@@ -249,13 +256,19 @@ void upload_emissive_light_data(OwningPtr<light_texture> &texture,
 
 void Light::PrepareBoundingVolumes() noexcept
 {
+	//Only point lights with a radius have any extent
 	if (type_ == LightType::Point && radius_ > 0.0_r)
+	{
 		aabb_ = Aabb::Size(radius_ * 2.0_r, position_);
+		obb_ = aabb_;
+		sphere_ = {radius_, position_};
+	}
 	else
+	{
 		aabb_ = {};
-
-	obb_ = aabb_;
-	sphere_ = {aabb_.ToHalfSize().Max(), aabb_.Center()};
+		obb_ = {};
+		sphere_ = {};
+	}
 }
 
 
@@ -295,9 +308,7 @@ Light::Light(std::optional<std::string> name, LightType type,
 	direction_{direction},
 	radius_{radius},
 
-	ambient_color_{ambient},
-	diffuse_color_{diffuse},
-	specular_color_{specular},
+	colors_{ambient, diffuse, specular},
 
 	attenuation_constant_{attenuation_constant},
 	attenuation_linear_{attenuation_linear},
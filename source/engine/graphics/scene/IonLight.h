@@ -76,6 +76,9 @@ namespace ion::graphics::scene
 				std::optional<textures::texture::TextureHandle> handle;
 				int width = 0;
 				int depth = 0;
+				std::vector<real> scratch_data;
+					//Reused between uploads, every light row is packed in here
+					//so that all changed rows can be uploaded with a single call
 			};
 
 			using light_texture_data = std::array<real, light_texture_width * 4>; //RGBA
@@ -129,9 +132,8 @@ namespace ion::graphics::scene
 			Vector3 direction_;
 			real radius_ = 0.0_r;
 
-			Color ambient_color_ = color::White;
-			Color diffuse_color_ = color::White;
-			Color specular_color_ = color::DarkGray;
+			std::array<Color, 3> colors_{color::White, color::White, color::DarkGray};
+				//Ambient, diffuse and specular (stored contiguously, so all twelve channels can be packed in one copy)
 
 			real attenuation_constant_ = 1.0_r;
 			real attenuation_linear_ = 0.0_r;
@@ -269,23 +271,23 @@ namespace ion::graphics::scene
 			///@brief Sets the color of the ambient light given off by this light source to the given color
 			inline void AmbientColor(const Color &ambient) noexcept
 			{
-				ambient_color_ = ambient;
+				colors_[0] = ambient;
 			}
-			
+
 			///@brief Sets the color of the diffuse light given off by this light source to the given color
 			///@details Also sets the ambient color if equal to the diffuse color
 			inline void DiffuseColor(const Color &diffuse) noexcept
 			{
-				if (diffuse_color_ == ambient_color_)
-					ambient_color_ = diffuse;
+				if (colors_[1] == colors_[0])
+					colors_[0] = diffuse;
 
-				diffuse_color_ = diffuse;
+				colors_[1] = diffuse;
 			}
-			
+
 			///@brief Sets the color of the specular light given off by this light source to the given color
 			inline void SpecularColor(const Color &specular) noexcept
 			{
-				specular_color_ = specular;
+				colors_[2] = specular;
 			}
 
 
@@ -358,19 +360,26 @@ namespace ion::graphics::scene
 			///@brief Returns the color of the ambient light given off by this light source
 			[[nodiscard]] inline auto& AmbientColor() const noexcept
 			{
-				return ambient_color_;
+				return colors_[0];
 			}
-			
+
 			///@brief Returns the color of the diffuse light given off by this light source
 			[[nodiscard]] inline auto& DiffuseColor() const noexcept
 			{
-				return diffuse_color_;
+				return colors_[1];
 			}
-			
+
 			///@brief Returns the color of the specular light given off by this light source
 			[[nodiscard]] inline auto& SpecularColor() const noexcept
 			{
-				return specular_color_;
+				return colors_[2];
+			}
+
+			///@brief Returns the ambient, diffuse and specular colors given off by this light source
+			///@details The colors are stored back to back, so all twelve channels can be copied in a single operation
+			[[nodiscard]] inline auto& Colors() const noexcept
+			{
+				return colors_;
 			}
 
 
@@ -389,6 +398,15 @@ namespace ion::graphics::scene
 								 light::detail::cutoff_to_angle(outer_cutoff_)};
 			}
 
+			///@brief Returns the inner and outer cutoff values (cosine of the angles) of the light
+			///@details These values only applies for lights of type spot light.
+			///This is the form the cutoff is stored in, and the form the shaders expect,
+			///so no conversion takes place
+			[[nodiscard]] inline auto CutoffValues() const noexcept
+			{
+				return std::pair{cutoff_, outer_cutoff_};
+			}
+
 
 			///@brief Returns true if this light cast shadows
 			[[nodiscard]] inline auto CastShadows() const noexcept
@@ -28,6 +28,20 @@ using namespace types::type_literals;
 
 namespace movable_object::detail
 {
+
+std::optional<Aabb> apply_extent(const Aabb &aabb, const Aabb &extent) noexcept
+{
+	if (auto [min, max] = extent.MinMax();
+		min != vector2::Zero || max != vector2::UnitScale)
+	{
+		auto size = aabb.ToSize();
+		return Aabb{aabb.Min() + min * size,
+					aabb.Max() + (max - vector2::UnitScale) * size};
+	}
+	else
+		return {};
+}
+
 } //movable_object::detail
 
 
@@ -55,16 +69,11 @@ Aabb MovableObject::DeriveWorldAxisAlignedBoundingBox(Aabb aabb, bool apply_exte
 	{
 		if (apply_extent)
 		{
-			if (auto [min, max] = bounding_volume_extent_.MinMax();
-				min != vector2::Zero || max != vector2::UnitScale)
-			{
-				auto size = aabb.ToSize();
-				aabb = Aabb{aabb.Min() + min * size,
-							aabb.Max() + (max - vector2::UnitScale) * size};
-			}
+			if (auto extended_aabb = detail::apply_extent(aabb, bounding_volume_extent_); extended_aabb)
+				aabb = *extended_aabb;
 		}
 
-		aabb.Transform(Matrix3::Transformation(parent_node_->FullTransformation()));
+		aabb.Transform(parent_node_->FullTransformation2D());
 	}
 
 	return aabb;
@@ -76,17 +85,11 @@ Obb MovableObject::DeriveWorldOrientedBoundingBox(Obb obb, Aabb aabb, bool apply
 	{
 		if (apply_extent)
 		{
-			if (auto [min, max] = bounding_volume_extent_.MinMax();
-				min != vector2::Zero || max != vector2::UnitScale)
-			{
-				auto size = aabb.ToSize();
-				aabb = Aabb{aabb.Min() + min * size,
-							aabb.Max() + (max - vector2::UnitScale) * size};
-				obb = aabb;
-			}
+			if (auto extended_aabb = detail::apply_extent(aabb, bounding_volume_extent_); extended_aabb)
+				obb = *extended_aabb;
 		}
 
-		obb.Transform(Matrix3::Transformation(parent_node_->FullTransformation()));
+		obb.Transform(parent_node_->FullTransformation2D());
 	}
 
 	return obb;
@@ -98,17 +101,11 @@ Sphere MovableObject::DeriveWorldBoundingSphere(Sphere sphere, Aabb aabb, bool a
 	{
 		if (apply_extent)
 		{
-			if (auto [min, max] = bounding_volume_extent_.MinMax();
-				min != vector2::Zero || max != vector2::UnitScale)
-			{
-				auto size = aabb.ToSize();
-				aabb = Aabb{aabb.Min() + min * size,
-							aabb.Max() + (max - vector2::UnitScale) * size};
-				sphere = {aabb.ToHalfSize().Max(), aabb.Center()};
-			}
+			if (auto extended_aabb = detail::apply_extent(aabb, bounding_volume_extent_); extended_aabb)
+				sphere = {extended_aabb->ToHalfSize().Max(), extended_aabb->Center()};
 		}
 
-		sphere.Transform(Matrix3::Transformation(parent_node_->FullTransformation()));
+		sphere.Transform(parent_node_->FullTransformation2D());
 	}
 
 	return sphere;
@@ -116,20 +113,10 @@ Sphere MovableObject::DeriveWorldBoundingSphere(Sphere sphere, Aabb aabb, bool a
 
 
 void MovableObject::DrawBoundingVolumes(const Aabb &aabb, const Obb &obb, const Sphere &sphere,
-	const Color &aabb_color, const Color &obb_color, const Color &sphere_color, real z) const noexcept
+	const Color &aabb_color, const Color &obb_color, const Color &sphere_color) const noexcept
 {
-	if (parent_node_)
-	{
-		graph::scene_graph::detail::push_gl_matrix(); //New view matrix
-		graph::scene_graph::detail::mult_gl_model_view_matrix(
-			Matrix4::Translation({0.0_r, 0.0_r, z})); //view * z translation matrix
-	}
-
-
-	//Enable fixed-function pipeline
-	auto active_program = shaders::shader_program_manager::detail::get_active_shader_program();
-	if (active_program > 0)
-		shaders::shader_program_manager::detail::use_shader_program(0);
+	//The z translated view matrix and the fixed-function pipeline (no shader program)
+	//are set up once by the caller for the whole bounds pass
 
 	//Draw bounding sphere
 	if (!sphere.Empty() && sphere_color != color::Transparent)
@@ -142,14 +129,6 @@ void MovableObject::DrawBoundingVolumes(const Aabb &aabb, const Obb &obb, const
 	//Draw axis-aligned bounding box
 	if (!aabb.Empty() && aabb_color != color::Transparent)
 		aabb.Draw(aabb_color);
-
-	//Re-enable active shader program (if any)
-	if (active_program > 0)
-		shaders::shader_program_manager::detail::use_shader_program(active_program);
-
-
-	if (parent_node_)
-		graph::scene_graph::detail::pop_gl_matrix(); //Restore
 }
 
 
@@ -223,12 +202,12 @@ void MovableObject::Prepare()
 	Drawing
 */
 
-void MovableObject::DrawBounds(real z) noexcept
+void MovableObject::DrawBounds([[maybe_unused]] real z) noexcept
 {
 	if (show_bounding_volumes_)
 		DrawBoundingVolumes(
 			WorldAxisAlignedBoundingBox(), WorldOrientedBoundingBox(), WorldBoundingSphere(),
-			aabb_color_, obb_color_, sphere_color_, z);
+			aabb_color_, obb_color_, sphere_color_);
 }
 
 
@@ -73,6 +73,9 @@ namespace ion::graphics::scene
 
 		namespace detail
 		{
+			///@brief Returns the given aabb remapped by the given extent (in range [0, 1])
+			///@details Returns nullopt if the given extent covers the whole aabb (nothing to remap)
+			std::optional<Aabb> apply_extent(const Aabb &aabb, const Aabb &extent) noexcept;
 		} //detail
 	} //movable_object
 
@@ -103,7 +106,7 @@ namespace ion::graphics::scene
 			Sphere DeriveWorldBoundingSphere(Sphere sphere, Aabb aabb, bool apply_extent = true) const noexcept;
 
 			void DrawBoundingVolumes(const Aabb &aabb, const Obb &obb, const Sphere &sphere,
-				const Color &aabb_color, const Color &obb_color, const Color &sphere_color, real z) const noexcept;
+				const Color &aabb_color, const Color &obb_color, const Color &sphere_color) const noexcept;
 
 			///@}
 
@@ -445,6 +448,8 @@ namespace ion::graphics::scene
 			*/
 
 			///@brief Draws the bounding volumes of this movable object
+			///@details The caller is expected to have translated the model view matrix
+			///to the given z depth, shared by every object drawn in the same pass
 			virtual void DrawBounds(real z) noexcept;
 
 			///@}
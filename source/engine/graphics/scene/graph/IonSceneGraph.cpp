@@ -25,6 +25,7 @@ File:	IonSceneGraph.cpp
 #include "graphics/scene/query/IonSceneQuery.h"
 #include "graphics/shaders/IonShaderLayout.h"
 #include "graphics/shaders/IonShaderProgram.h"
+#include "graphics/shaders/IonShaderProgramManager.h"
 #include "graphics/textures/IonTextureManager.h"
 #include "utilities/IonMath.h"
 
@@ -422,6 +423,10 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 	else
 		return;
 
+	const auto &camera_aabb = camera->WorldAxisAlignedBoundingBox(false, false);
+		//The camera does not move during rendering, so the cached world AABB
+		//can be reused for all culling tests below (per object, light and emissive light)
+
 
 	const auto &projection_mat = camera->ViewFrustum().ProjectionMatrix();
 	const auto &view_mat = camera->ViewMatrix();
@@ -469,7 +474,7 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 			//Object visible and in view
 			if (object_visible &&
 				(object->WorldAxisAlignedBoundingBox(true, false).Empty() || //Cull based on actual geometry
-				 object->WorldAxisAlignedBoundingBox(false, false).Intersects(camera->WorldAxisAlignedBoundingBox(false, false))))
+				 object->WorldAxisAlignedBoundingBox(false, false).Intersects(camera_aabb)))
 			{	
 				visible_objects_.push_back(object);
 
@@ -481,7 +486,7 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 						//Emissive light visible and in view
 						if (light->Visible() &&
 							(light->WorldAxisAlignedBoundingBox(true, false).Empty() || //Derive, emissive lights are not pre-cached!
-							 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera->WorldAxisAlignedBoundingBox(false, false))))
+							 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera_aabb)))
 
 							emissive_lights_.push_back(light);
 					}
@@ -513,7 +518,7 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 			//Light visible and in view
 			if (light->Visible() && light->ParentNode()->Visible() &&
 				(light->WorldAxisAlignedBoundingBox(false, false).Empty() ||
-				 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera->WorldAxisAlignedBoundingBox(false, false))))
+				 light->WorldAxisAlignedBoundingBox(false, false).Intersects(camera_aabb)))
 
 				lights_.push_back(light);
 		}
@@ -564,8 +569,26 @@ void SceneGraph::Render(render::Viewport &viewport, duration time) noexcept
 		auto [min_z, max_z] = *z_range;
 
 		//Draw bounding volumes
+		//The z translation is the same for every object,
+		//so set up the view matrix once for the whole pass instead of once per object
+		detail::push_gl_matrix(); //New view matrix
+		detail::mult_gl_model_view_matrix(
+			Matrix4::Translation({0.0_r, 0.0_r, max_z})); //view * z translation matrix
+
+		//Enable fixed-function pipeline once for the whole pass,
+		//instead of toggling the shader program on and off per object
+		auto active_program = shaders::shader_program_manager::detail::get_active_shader_program();
+		if (active_program > 0)
+			shaders::shader_program_manager::detail::use_shader_program(0);
+
 		for (auto &object : visible_objects_)
 			object->DrawBounds(max_z);
+
+		//Re-enable active shader program (if any)
+		if (active_program > 0)
+			shaders::shader_program_manager::detail::use_shader_program(active_program);
+
+		detail::pop_gl_matrix(); //Restore
 	}
 }
 
@@ -116,7 +116,11 @@ node_container depth_first_search(const SceneNode &node, DepthFirstTraversal tra
 
 Matrix4 make_transformation(const Vector3 &position, real rotation, const Vector2 &scaling) noexcept
 {
-	return Matrix4::Transformation(rotation, to_scaling3(scaling), position);
+	//Unrotated and unscaled nodes only need a translation matrix (no sin/cos)
+	if (rotation == 0.0_r && scaling == vector2::UnitScale)
+		return Matrix4::Translation(position);
+	else
+		return Matrix4::Transformation(rotation, to_scaling3(scaling), position);
 }
 
 } //scene_node::detail
@@ -137,8 +141,23 @@ void SceneNode::NotifyRemoved() noexcept
 }
 
 
+void SceneNode::NotifyNewRootNode(SceneNode *root_node) noexcept
+{
+	root_node_ = root_node;
+
+	for (auto &child_node : child_nodes_)
+		child_node->NotifyNewRootNode(root_node); //Recursive
+}
+
+
 void SceneNode::NotifyUpdate() noexcept
 {
+	//A node is only updated after all of its ancestors,
+	//so a node that needs an update implies that its entire subtree does.
+	//The subtree has then already been notified
+	if (need_update_)
+		return;
+
 	need_update_ = true;
 
 	for (auto &child_node : child_nodes_)
@@ -147,6 +166,10 @@ void SceneNode::NotifyUpdate() noexcept
 
 void SceneNode::NotifyUpdateZ() noexcept
 {
+	//See NotifyUpdate for rationale
+	if (need_z_update_)
+		return;
+
 	need_z_update_ = true;
 
 	for (auto &child_node : child_nodes_)
@@ -194,6 +217,7 @@ void SceneNode::Update() const noexcept
 	need_update_ = false;
 	need_z_update_ = false;
 	transformation_out_of_date_ = true;
+	transformation2d_out_of_date_ = true;
 }
 
 void SceneNode::UpdateZ() const noexcept
@@ -314,6 +338,7 @@ void SceneNode::GatherLights(detail::light_container &lights)
 void SceneNode::AttachNode(SceneNode *node)
 {
 	node->parent_node_ = this;
+	node->NotifyNewRootNode(root_node_);
 
 	node->MoveNodes(node->RootNode().ordered_nodes_, node->ordered_nodes_);
 	node->MoveCameras(node->RootNode().attached_cameras_, node->attached_cameras_);
@@ -327,6 +352,7 @@ void SceneNode::DetachNode(SceneNode *node)
 {
 	node->Tidy();
 	node->parent_node_ = nullptr;
+	node->NotifyNewRootNode(node);
 	node->NotifyUpdate();
 	node->NotifyUpdateZ();
 }
@@ -488,7 +514,8 @@ SceneNode::SceneNode(std::optional<std::string> name, SceneNode &parent_node, co
 	direction_{initial_direction},
 	initial_direction_{initial_direction},
 	visible_{visible},
-	parent_node_{&parent_node}
+	parent_node_{&parent_node},
+	root_node_{parent_node.root_node_}
 {
 	AddNode(RootNode().ordered_nodes_, this);
 }
@@ -517,8 +544,14 @@ SceneNode::~SceneNode() noexcept
 
 bool SceneNode::AxisAligned() const noexcept
 {
+	auto rotation = DerivedRotation();
+
+	//Most nodes are not rotated at all
+	if (rotation == 0.0_r)
+		return true;
+
 	//Axis aligned when 0, +-90, +-180, +-270 and +-360 (half degree tolerance)
-	return std::fmod(math::Round(math::ToDegrees(DerivedRotation())), 90.0_r) == 0.0_r;
+	return std::fmod(math::Round(math::ToDegrees(rotation)), 90.0_r) == 0.0_r;
 }
 
 
@@ -556,7 +589,7 @@ const Obb& SceneNode::WorldOrientedBoundingBox(bool derive) const noexcept
 		}
 
 		world_obb_ = aabb_;
-		world_obb_.Transform(Matrix3::Transformation(FullTransformation()));
+		world_obb_.Transform(FullTransformation2D());
 	}
 
 	return world_obb_;
@@ -25,6 +25,7 @@ File:	IonSceneNode.h
 #include "adaptors/ranges/IonIterable.h"
 #include "animations/IonNodeAnimationManager.h"
 #include "graphics/utilities/IonAabb.h"
+#include "graphics/utilities/IonMatrix3.h"
 #include "graphics/utilities/IonMatrix4.h"
 #include "graphics/utilities/IonObb.h"
 #include "graphics/utilities/IonSphere.h"
@@ -318,6 +319,7 @@ namespace ion::graphics::scene::graph
 			bool visible_ = true;
 
 			SceneNode *parent_node_ = nullptr;
+			SceneNode *root_node_ = this; //Cached, so root lookups do not walk the parent chain
 			scene_node::SceneNodes child_nodes_;
 			scene_node::detail::object_container attached_objects_;
 			std::any user_data_;
@@ -333,6 +335,7 @@ namespace ion::graphics::scene::graph
 			mutable real derived_rotation_ = 0.0_r;
 			mutable Vector2 derived_scaling_;
 			mutable Matrix4 full_tranformation_;
+			mutable Matrix3 full_tranformation2d_;
 
 			mutable Aabb aabb_;
 			mutable Aabb world_aabb_;
@@ -342,6 +345,7 @@ namespace ion::graphics::scene::graph
 			mutable bool need_update_ = true;
 			mutable bool need_z_update_ = true;
 			mutable bool transformation_out_of_date_ = true;
+			mutable bool transformation2d_out_of_date_ = true;
 
 
 			/**
@@ -350,9 +354,10 @@ namespace ion::graphics::scene::graph
 			*/
 
 			void NotifyRemoved() noexcept;
+			void NotifyNewRootNode(SceneNode *root_node) noexcept;
 
 			void NotifyUpdate() noexcept;
-			void NotifyUpdateZ() noexcept;		
+			void NotifyUpdateZ() noexcept;
 
 			///@}
 
@@ -797,19 +802,13 @@ namespace ion::graphics::scene::graph
 			///@brief Returns a mutable reference to the root node of this node
 			[[nodiscard]] inline auto RootNode() noexcept -> SceneNode&
 			{
-				if (parent_node_)
-					return parent_node_->RootNode(); //Recursive
-				else
-					return *this;
+				return *root_node_;
 			}
 
 			///@brief Returns an immutable reference to the root node of this node
 			[[nodiscard]] inline auto RootNode() const noexcept -> const SceneNode&
 			{
-				if (parent_node_)
-					return parent_node_->RootNode(); //Recursive
-				else
-					return *this;
+				return *root_node_;
 			}
 
 			///@brief Returns the custom user data for this node
@@ -871,6 +870,20 @@ namespace ion::graphics::scene::graph
 				return full_tranformation_;
 			}
 
+			///@brief Returns the full transformation matrix for this node, as a 2D (3x3) matrix
+			///@details The matrix is cached, so deriving multiple world geometries
+			///through the same node does not extract it more than once
+			[[nodiscard]] inline auto& FullTransformation2D() const noexcept
+			{
+				if (need_update_ || transformation_out_of_date_ || transformation2d_out_of_date_)
+				{
+					full_tranformation2d_ = Matrix3::Transformation(FullTransformation());
+					transformation2d_out_of_date_ = false;
+				}
+
+				return full_tranformation2d_;
+			}
+
 
 			///@brief Returns true if this node is axis aligned
 			[[nodiscard]] bool AxisAligned() const noexcept;
@@ -146,22 +146,22 @@ real move_amount(moving_amount &amount, real percent) noexcept
 				switch (amount.technique)
 				{
 					case MotionTechniqueType::Cubic:
-					return amount.target * cubic(percent, 0.0_r, 10.0_r);
+					return amount.target * cubic<0.0_r, 10.0_r>(percent);
 
 					case MotionTechniqueType::Exponential:
-					return amount.target * exp(percent, 0.0_r, 10.0_r);
+					return amount.target * exp<0.0_r, 10.0_r>(percent);
 
 					case MotionTechniqueType::Logarithmic:
-					return amount.target * log(percent, 1.0_r, 10.0_r);
+					return amount.target * log<1.0_r, 10.0_r>(percent);
 
 					case MotionTechniqueType::Sigmoid:
-					return amount.target * sigmoid(percent, -5.0_r, 5.0_r);
+					return amount.target * sigmoid<-5.0_r, 5.0_r>(percent);
 
 					case MotionTechniqueType::Sinh:
-					return amount.target * sinh(percent, -2.5_r, 2.5_r);
+					return amount.target * sinh<-2.5_r, 2.5_r>(percent);
 
 					case MotionTechniqueType::Tanh:
-					return amount.target * tanh(percent, -2.5_r, 2.5_r);
+					return amount.target * tanh<-2.5_r, 2.5_r>(percent);
 
 					case MotionTechniqueType::Linear:
 					default:
@@ -95,25 +95,41 @@ namespace ion::graphics::scene::graph::animations
 				@{
 			*/
 
-			inline auto cubic(real percent, real min, real max) noexcept
+			//The curve bounds are given as template arguments,
+			//so the curve values at the endpoints only need to be computed once
+
+			template <real Min, real Max>
+			inline auto cubic(real percent) noexcept
 			{
 				using namespace ion::utilities;
-				auto x = math::Normalize(percent, 0.0_r, 1.0_r, min, max);
-				return math::Normalize(std::pow(x, 3.0_r), std::pow(min, 3.0_r), std::pow(max, 3.0_r));
+				constexpr auto cubic_min = Min * Min * Min;
+				constexpr auto cubic_max = Max * Max * Max;
+
+				auto x = math::Normalize(percent, 0.0_r, 1.0_r, Min, Max);
+				return math::Normalize(x * x * x, cubic_min, cubic_max);
+					//x * x * x instead of pow, which is a full transcendental even for integer exponents
 			}
 
-			inline auto exp(real percent, real min, real max) noexcept
+			template <real Min, real Max>
+			inline auto exp(real percent) noexcept
 			{
 				using namespace ion::utilities;
-				auto x = math::Normalize(percent, 0.0_r, 1.0_r, min, max);
-				return math::Normalize(std::exp(x), std::exp(min), std::exp(max));
+				static const auto exp_min = std::exp(Min);
+				static const auto exp_max = std::exp(Max);
+
+				auto x = math::Normalize(percent, 0.0_r, 1.0_r, Min, Max);
+				return math::Normalize(std::exp(x), exp_min, exp_max);
 			}
 
-			inline auto log(real percent, real min, real max) noexcept
+			template <real Min, real Max>
+			inline auto log(real percent) noexcept
 			{
 				using namespace ion::utilities;
-				auto x = math::Normalize(percent, 0.0_r, 1.0_r, min, max);
-				return math::Normalize(std::log(x), std::log(min), std::log(max));
+				static const auto log_min = std::log(Min);
+				static const auto log_max = std::log(Max);
+
+				auto x = math::Normalize(percent, 0.0_r, 1.0_r, Min, Max);
+				return math::Normalize(std::log(x), log_min, log_max);
 			}
 
 			inline auto sigmoid(real x) noexcept
@@ -122,25 +138,37 @@ namespace ion::graphics::scene::graph::animations
 				return 1.0_r / (1.0_r + std::pow(math::E, -x));
 			}
 
-			inline auto sigmoid(real percent, real min, real max) noexcept
+			template <real Min, real Max>
+			inline auto sigmoid(real percent) noexcept
 			{
 				using namespace ion::utilities;
-				auto x = math::Normalize(percent, 0.0_r, 1.0_r, min, max);
-				return math::Normalize(sigmoid(x), sigmoid(min), sigmoid(max));
+				static const auto sigmoid_min = sigmoid(Min);
+				static const auto sigmoid_max = sigmoid(Max);
+
+				auto x = math::Normalize(percent, 0.0_r, 1.0_r, Min, Max);
+				return math::Normalize(sigmoid(x), sigmoid_min, sigmoid_max);
 			}
 
-			inline auto sinh(real percent, real min, real max) noexcept
+			template <real Min, real Max>
+			inline auto sinh(real percent) noexcept
 			{
 				using namespace ion::utilities;
-				auto x = math::Normalize(percent, 0.0_r, 1.0_r, min, max);
-				return math::Normalize(std::sinh(x), std::sinh(min), std::sinh(max));
+				static const auto sinh_min = std::sinh(Min);
+				static const auto sinh_max = std::sinh(Max);
+
+				auto x = math::Normalize(percent, 0.0_r, 1.0_r, Min, Max);
+				return math::Normalize(std::sinh(x), sinh_min, sinh_max);
 			}
 
-			inline auto tanh(real percent, real min, real max) noexcept
+			template <real Min, real Max>
+			inline auto tanh(real percent) noexcept
 			{
 				using namespace ion::utilities;
-				auto x = math::Normalize(percent, 0.0_r, 1.0_r, min, max);
-				return math::Normalize(std::tanh(x), std::tanh(min), std::tanh(max));
+				static const auto tanh_min = std::tanh(Min);
+				static const auto tanh_max = std::tanh(Max);
+
+				auto x = math::Normalize(percent, 0.0_r, 1.0_r, Min, Max);
+				return math::Normalize(std::tanh(x), tanh_min, tanh_max);
 			}
 
 			///@}
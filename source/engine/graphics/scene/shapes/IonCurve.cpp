@@ -12,10 +12,7 @@ File:	IonCurve.cpp
 
 #include "IonCurve.h"
 
-#include <cmath>
-
 #include "IonLine.h"
-#include "utilities/IonMath.h"
 
 namespace ion::graphics::scene::shapes
 {
@@ -27,8 +24,6 @@ namespace curve::detail
 
 mesh::Vertices curve_vertices(const ControlPoints &control_points, const Color &color, int smoothness)
 {
-	using namespace ion::utilities;
-
 	if (std::ssize(control_points) > max_control_points)
 		return {};
 
@@ -48,25 +43,27 @@ mesh::Vertices curve_vertices(const ControlPoints &control_points, const Color &
 	}
 
 	//Use bezier
-	auto point = vector3::Zero;
 	auto percent = 1.0_r;
 	auto step = 1.0_r / (vertex_count - 1);
 
-	//Calculate each coordinate in the bezier curve
-	for (auto i = 0; i < vertex_count; ++i, percent -= step, point = vector3::Zero)
+	ControlPoints points; //Scratch, reused between samples
+
+	//Calculate each coordinate in the bezier curve (de Casteljau)
+	//Repeated linear interpolation uses no binomials or pow,
+	//so it stays numerically stable for higher numbers of control points
+	for (auto i = 0; i < vertex_count; ++i, percent -= step)
 	{
-		for (auto j = 0; auto &p : control_points)
+		points.assign(std::begin(control_points), std::end(control_points));
+
+		for (auto k = std::ssize(points) - 1; k > 0; --k)
 		{
-			auto bezier =
-				math::Choose(std::ssize(control_points) - 1, j) *
-				std::pow(percent, static_cast<real>(std::ssize(control_points) - j - 1)) *
-				std::pow(1.0_r - percent, static_cast<real>(j));
-
-			point += p * bezier;
-			point.Z(p.Z());
-			++j;
+			for (auto j = 0; j < k; ++j)
+				points[j] = points[j] * percent + points[j + 1] * (1.0_r - percent);
 		}
 
+		auto point = points.front();
+		point.Z(control_points.back().Z()); //All vertices share the z of the last control point
+
 		vertices.push_back({point, vector3::UnitZ, color});
 	}
 
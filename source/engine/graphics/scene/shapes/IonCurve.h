@@ -36,7 +36,9 @@ namespace ion::graphics::scene::shapes
 			constexpr auto min_curve_smoothness = 0;
 
 			constexpr auto max_control_points = 35;
-				//Factorial(35 - 1) returns the largest result you can store in a real (32-bit float)
+				//Kept as the documented upper limit, originally imposed by the old
+				//factorial-based evaluation (Factorial(35 - 1) was the largest result
+				//you could store in a 32-bit float). De Casteljau has no such limit
 
 
 			inline auto curve_smoothness(int smoothness) noexcept
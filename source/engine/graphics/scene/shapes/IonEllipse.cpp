@@ -32,6 +32,10 @@ mesh::Vertices ellipse_vertices(const Vector3 &position, real rotation, const Ve
 	auto angle = 0.0_r;
 	auto delta_angle = math::TwoPi / sides;
 
+	auto sin_of_rotation = math::Sin(rotation);
+	auto cos_of_rotation = math::Cos(rotation);
+		//Compute sin/cos of the rotation once, instead of once per vertex
+
 	mesh::Vertices vertices;
 	vertices.reserve(sides);
 
@@ -39,7 +43,7 @@ mesh::Vertices ellipse_vertices(const Vector3 &position, real rotation, const Ve
 	{
 		auto v =
 			(position + Vector2{half_width * math::Cos(angle), half_height * math::Sin(angle)}).
-			RotateCopy(rotation, position);
+			RotateCopy(sin_of_rotation, cos_of_rotation, position);
 
 		vertices.push_back({v, vector3::UnitZ, color});
 	}
@@ -113,9 +113,10 @@ namespace ion::graphics::scene::shapes
 			}
 
 			///@brief Returns the points a b of this line
+			///@details The points are returned as references, so nothing is copied
 			[[nodiscard]] inline auto AB() const noexcept
 			{
-				return std::pair{a_, b_};
+				return std::pair<const Vector3&, const Vector3&>{a_, b_};
 			}
 
 			///@brief Returns the thickness of this line
@@ -92,8 +92,13 @@ void generate_tex_coords(render_primitive::VertexContainer &vertex_data, const A
 
 void normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const materials::Material *material) noexcept
 {
-	if (auto [s_repeatable, t_repeatable] = material ?
-		material->IsRepeatable() : std::pair{false, false}; !s_repeatable || !t_repeatable)
+	auto [world_tex_coords, repeatable] = material ?
+		material->GetTexCoordsInfo() :
+		materials::material::TexCoordsInfo{{vector2::Zero, vector2::UnitScale}, {false, false}};
+		//Resolve tex coords and repeatability in one call,
+		//so the material texture map chain is only followed once
+
+	if (auto [s_repeatable, t_repeatable] = repeatable; !s_repeatable || !t_repeatable)
 	{
 		//Clamp each vertex tex coords (s,t) to range [0, 1]
 		for (auto i = detail::tex_coord_offset; i < std::ssize(vertex_data);
@@ -108,9 +113,7 @@ void normalize_tex_coords(render_primitive::VertexContainer &vertex_data, const
 	}
 
 
-	auto [world_lower_left_tex_coord, world_upper_right_tex_coord] = material ?
-		material->WorldTexCoords() :
-		std::pair{vector2::Zero, vector2::UnitScale};
+	auto &[world_lower_left_tex_coord, world_upper_right_tex_coord] = world_tex_coords;
 	auto [world_lower_left, world_upper_right] =
 		materials::material::detail::get_unflipped_tex_coords(world_lower_left_tex_coord, world_upper_right_tex_coord);
 
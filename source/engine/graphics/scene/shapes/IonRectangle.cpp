@@ -12,6 +12,8 @@ File:	IonRectangle.cpp
 
 #include "IonRectangle.h"
 
+#include "utilities/IonMath.h"
+
 namespace ion::graphics::scene::shapes
 {
 
@@ -22,12 +24,18 @@ namespace rectangle::detail
 
 mesh::Vertices rectangle_vertices(const Vector3 &position, real rotation, const Vector2 &size, const Color &color)
 {
+	using namespace ion::utilities;
+
 	auto [half_width, half_height] = (size * 0.5_r).XY();
 
-	auto v1 = (position + Vector2{-half_width, half_height}).RotateCopy(rotation, position);
-	auto v2 = (position + Vector2{-half_width, -half_height}).RotateCopy(rotation, position);
-	auto v3 = (position + Vector2{half_width, -half_height}).RotateCopy(rotation, position);
-	auto v4 = (position + Vector2{half_width, half_height}).RotateCopy(rotation, position);
+	//All four corners rotate by the same angle, so compute the sine and cosine once
+	auto sin_of_angle = math::Sin(rotation);
+	auto cos_of_angle = math::Cos(rotation);
+
+	auto v1 = (position + Vector2{-half_width, half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
+	auto v2 = (position + Vector2{-half_width, -half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
+	auto v3 = (position + Vector2{half_width, -half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
+	auto v4 = (position + Vector2{half_width, half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
 
 	return {{v1, vector3::UnitZ, {0.0_r, 1.0_r}, color},
 			{v2, vector3::UnitZ, {0.0_r, 0.0_r}, color},
@@ -18,6 +18,7 @@ File:	IonSprite.cpp
 #include "graphics/textures/IonTexture.h"
 #include "graphics/textures/IonTextureManager.h"
 #include "graphics/materials/IonMaterial.h"
+#include "utilities/IonMath.h"
 
 namespace ion::graphics::scene::shapes
 {
@@ -30,12 +31,18 @@ namespace sprite::detail
 mesh::Vertices sprite_vertices(const Vector3 &position, real rotation, const Vector2 &size, const Color &color,
 	const Vector2 &lower_left_tex_coord, const Vector2 &upper_right_tex_coord)
 {
+	using namespace ion::utilities;
+
 	auto [half_width, half_height] = (size * 0.5_r).XY();
 
-	auto v1 = (position + Vector2{-half_width, half_height}).RotateCopy(rotation, position);
-	auto v2 = (position + Vector2{-half_width, -half_height}).RotateCopy(rotation, position);
-	auto v3 = (position + Vector2{half_width, -half_height}).RotateCopy(rotation, position);
-	auto v4 = (position + Vector2{half_width, half_height}).RotateCopy(rotation, position);
+	//All four corners rotate by the same angle, so compute the sine and cosine once
+	auto sin_of_angle = math::Sin(rotation);
+	auto cos_of_angle = math::Cos(rotation);
+
+	auto v1 = (position + Vector2{-half_width, half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
+	auto v2 = (position + Vector2{-half_width, -half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
+	auto v3 = (position + Vector2{half_width, -half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
+	auto v4 = (position + Vector2{half_width, half_height}).RotateCopy(sin_of_angle, cos_of_angle, position);
 
 	auto [ll_s, ll_t] = lower_left_tex_coord.XY();
 	auto [ur_s, ur_t] = upper_right_tex_coord.XY();
@@ -120,9 +120,10 @@ namespace ion::graphics::scene::shapes
 			}
 
 			///@brief Returns the points a b c of this triangle
+			///@details The points are returned as references, so nothing is copied
 			[[nodiscard]] inline auto ABC() const noexcept
 			{
-				return std::tuple{a_, b_, c_};
+				return std::tuple<const Vector3&, const Vector3&, const Vector3&>{a_, b_, c_};
 			}
 
 			///@}
@@ -188,7 +188,7 @@ std::optional<texture::TextureHandle> load_texture(const std::string &pixel_data
 {
 	texture::TextureHandle texture_handle;
 	glGenTextures(1, reinterpret_cast<unsigned int*>(&texture_handle.Id));
-	glBindTexture(GL_TEXTURE_2D, texture_handle.Id);
+	gl::BindTexture(GL_TEXTURE_2D, texture_handle.Id);
 
 	auto has_latest_generate_mipmap =
 		gl::HasGL(gl::Version::v3_0) ||
@@ -282,13 +282,14 @@ std::optional<texture::TextureHandle> load_texture(const std::string &pixel_data
 	if (has_latest_generate_mipmap)
 		glGenerateMipmap(GL_TEXTURE_2D);
 
-	glBindTexture(GL_TEXTURE_2D, 0);
+	gl::BindTexture(GL_TEXTURE_2D, 0);
 	return texture_handle;
 }
 
 void unload_texture(texture::TextureHandle texture_handle) noexcept
 {
 	glDeleteTextures(1, reinterpret_cast<unsigned int*>(&texture_handle.Id));
+	gl::InvalidateTextureBindings(texture_handle.Id); //Deleted texture names can be reused
 }
 
 
@@ -390,7 +391,7 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_textu
 		std::string atlas_pixel_data(atlas_extents.ActualWidth * atlas_extents.ActualHeight * color_bytes, '\0');
 
 		//Pack image from gl to memory
-		glBindTexture(GL_TEXTURE_2D, texture_atlas.Handle()->Id);
+		gl::BindTexture(GL_TEXTURE_2D, texture_atlas.Handle()->Id);
 		glPixelStorei(GL_PACK_ALIGNMENT, 1); //May increase transfer speed for NPOT
 		glGetTexImage(GL_TEXTURE_2D, 0,
 				[&]() noexcept
@@ -401,7 +402,7 @@ std::optional<std::pair<std::string, texture::TextureExtents>> prepare_sub_textu
 						return atlas_extents.BitDepth == 32 ? GL_RGBA : GL_RGB;
 				}(),
 			GL_UNSIGNED_BYTE, std::data(atlas_pixel_data));
-		glBindTexture(GL_TEXTURE_2D, 0);
+		gl::BindTexture(GL_TEXTURE_2D, 0);
 
 		//Copy sub texture bytes from texture atlas at the given position
 		for (auto ai = x * color_bytes + y * color_bytes * atlas_extents.ActualWidth,
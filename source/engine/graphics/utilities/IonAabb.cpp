@@ -224,41 +224,10 @@ Vector2 Aabb::ToSize() const noexcept
 }
 
 
-/*
-	Containing
-*/
-
-bool Aabb::Contains(const Aabb &aabb) const noexcept
-{
-	return min_.X() <= aabb.min_.X() && min_.Y() <= aabb.min_.Y() &&
-		   max_.X() >= aabb.max_.X() && max_.Y() >= aabb.max_.Y();
-}
-
-bool Aabb::Contains(const Vector2 &point) const noexcept
-{
-	return Intersects(point);
-}
-
 /*
 	Intersecting
 */
 
-bool Aabb::Intersects(const Aabb &aabb) const noexcept
-{
-	return max_.X() >= aabb.min_.X() &&
-		   max_.Y() >= aabb.min_.Y() &&
-			 
-		   min_.X() <= aabb.max_.X() &&
-		   min_.Y() <= aabb.max_.Y();	
-}
-
-bool Aabb::Intersects(const Vector2 &point) const noexcept
-{
-	return point.X() >= min_.X() && point.X() <= max_.X() &&
-		   point.Y() >= min_.Y() && point.Y() <= max_.Y();
-}
-
-
 Aabb Aabb::Intersection(const Aabb &aabb) const noexcept
 {
 	auto intersect_min = min_.CeilCopy(aabb.min_);
@@ -311,10 +280,14 @@ Aabb Aabb::MergeCopy(const Vector2 &point) const noexcept
 Aabb& Aabb::Rotate(real angle) noexcept
 {
 	auto center = Center();
-	auto tl = Vector2{min_.X(), max_.Y()}.RotateCopy(angle, center);
-	auto tr = max_.RotateCopy(angle, center);
-	auto bl = min_.RotateCopy(angle, center);
-	auto br = Vector2{max_.X(), min_.Y()}.RotateCopy(angle, center);
+	auto sin_of_angle = math::Sin(angle);
+	auto cos_of_angle = math::Cos(angle);
+		//Compute sin/cos of the angle once, instead of once per corner
+
+	auto tl = Vector2{min_.X(), max_.Y()}.RotateCopy(sin_of_angle, cos_of_angle, center);
+	auto tr = max_.RotateCopy(sin_of_angle, cos_of_angle, center);
+	auto bl = min_.RotateCopy(sin_of_angle, cos_of_angle, center);
+	auto br = Vector2{max_.X(), min_.Y()}.RotateCopy(sin_of_angle, cos_of_angle, center);
 
 	min_ = tl.FloorCopy(tr).FloorCopy(bl).FloorCopy(br);
 	max_ = tl.CeilCopy(tr).CeilCopy(bl).CeilCopy(br);
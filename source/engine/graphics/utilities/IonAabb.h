@@ -213,10 +213,17 @@ namespace ion::graphics::utilities
 			*/
 
 			///@brief Returns true if this aabb contains the given aabb
-			[[nodiscard]] bool Contains(const Aabb &aabb) const noexcept;
+			[[nodiscard]] inline auto Contains(const Aabb &aabb) const noexcept
+			{
+				return min_.X() <= aabb.min_.X() && min_.Y() <= aabb.min_.Y() &&
+					   max_.X() >= aabb.max_.X() && max_.Y() >= aabb.max_.Y();
+			}
 
 			///@brief Returns true if this aabb contains the given point
-			[[nodiscard]] bool Contains(const Vector2 &point) const noexcept;
+			[[nodiscard]] inline auto Contains(const Vector2 &point) const noexcept
+			{
+				return Intersects(point);
+			}
 
 			///@}
 
@@ -226,10 +233,23 @@ namespace ion::graphics::utilities
 			*/
 
 			///@brief Returns true if this aabb intersects the given aabb
-			[[nodiscard]] bool Intersects(const Aabb &aabb) const noexcept;
+			///@details Defined inline so that per-object culling tests can be
+			///inlined (and auto-vectorized) at the call site
+			[[nodiscard]] inline auto Intersects(const Aabb &aabb) const noexcept
+			{
+				return max_.X() >= aabb.min_.X() &&
+					   max_.Y() >= aabb.min_.Y() &&
+
+					   min_.X() <= aabb.max_.X() &&
+					   min_.Y() <= aabb.max_.Y();
+			}
 
 			///@brief Returns true if this aabb intersects the given point
-			[[nodiscard]] bool Intersects(const Vector2 &point) const noexcept;
+			[[nodiscard]] inline auto Intersects(const Vector2 &point) const noexcept
+			{
+				return point.X() >= min_.X() && point.X() <= max_.X() &&
+					   point.Y() >= min_.Y() && point.Y() <= max_.Y();
+			}
 
 
 			///@brief Returns the intersection of this aabb and the given aabb
@@ -460,8 +460,20 @@ Matrix3& Matrix3::Inverse() noexcept
 
 Matrix3 Matrix3::InverseCopy() const noexcept
 {
-	Matrix3 matrix{*this};
-	return matrix.Adjoint() * (1.0_r / Determinant());
+	//The adjoint divided by the determinant, written out in a single sweep
+	//Does not materialize the cofactor and transpose temporaries
+	auto inv_det = 1.0_r / Determinant();
+	return {  (m_[1][1] * m_[2][2] - m_[2][1] * m_[1][2]) * inv_det,
+			-(m_[0][1] * m_[2][2] - m_[2][1] * m_[0][2]) * inv_det,
+			  (m_[0][1] * m_[1][2] - m_[1][1] * m_[0][2]) * inv_det,
+
+			-(m_[1][0] * m_[2][2] - m_[2][0] * m_[1][2]) * inv_det,
+			  (m_[0][0] * m_[2][2] - m_[2][0] * m_[0][2]) * inv_det,
+			-(m_[0][0] * m_[1][2] - m_[1][0] * m_[0][2]) * inv_det,
+
+			  (m_[1][0] * m_[2][1] - m_[2][0] * m_[1][1]) * inv_det,
+			-(m_[0][0] * m_[2][1] - m_[2][0] * m_[0][1]) * inv_det,
+			  (m_[0][0] * m_[1][1] - m_[1][0] * m_[0][1]) * inv_det};
 }
 
 
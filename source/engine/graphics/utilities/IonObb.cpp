@@ -16,6 +16,7 @@ File:	IonObb.cpp
 
 #include "IonMatrix3.h"
 #include "graphics/IonGraphicsAPI.h"
+#include "utilities/IonMath.h"
 
 #undef max
 
@@ -239,11 +240,17 @@ bool Obb::Intersects(const Vector2 &point) const noexcept
 
 Obb& Obb::Rotate(real angle) noexcept
 {
+	using namespace ion::utilities;
+
 	auto center = Center();
-	corners_[0].Rotate(angle, center);
-	corners_[1].Rotate(angle, center);
-	corners_[2].Rotate(angle, center);
-	corners_[3].Rotate(angle, center);
+	auto sin_of_angle = math::Sin(angle);
+	auto cos_of_angle = math::Cos(angle);
+		//Compute sin/cos of the angle once, instead of once per corner
+
+	corners_[0] = corners_[0].RotateCopy(sin_of_angle, cos_of_angle, center);
+	corners_[1] = corners_[1].RotateCopy(sin_of_angle, cos_of_angle, center);
+	corners_[2] = corners_[2].RotateCopy(sin_of_angle, cos_of_angle, center);
+	corners_[3] = corners_[3].RotateCopy(sin_of_angle, cos_of_angle, center);
 	return *this;
 }
 
@@ -131,9 +131,11 @@ real Vector2::DotProduct(const Vector2 &vector) const noexcept
 
 Vector2 Vector2::Deviant(real angle) const noexcept
 {
-	auto sin_of_angle = math::Sin(angle);
-	auto cos_of_angle = math::Cos(angle);
+	return Deviant(math::Sin(angle), math::Cos(angle));
+}
 
+Vector2 Vector2::Deviant(real sin_of_angle, real cos_of_angle) const noexcept
+{
 	#ifdef ION_LEFT_HANDED
 	//Left-hand rotation CW
 	return {cos_of_angle * x_ + sin_of_angle * y_,
@@ -374,6 +376,11 @@ Vector2 Vector2::RotateCopy(real angle, const Vector2 &origin) const noexcept
 	return (*this - origin).Deviant(angle) + origin;
 }
 
+Vector2 Vector2::RotateCopy(real sin_of_angle, real cos_of_angle, const Vector2 &origin) const noexcept
+{
+	return (*this - origin).Deviant(sin_of_angle, cos_of_angle) + origin;
+}
+
 
 /*
 	Scaling
@@ -386,6 +386,11 @@ namespace ion::graphics::utilities
 			///@brief Returns a vector that deviates from this vector by a given angle (radians)
 			[[nodiscard]] Vector2 Deviant(real angle) const noexcept;
 
+			///@brief Returns a vector that deviates from this vector by the given precomputed sine and cosine of an angle
+			///@details Use this overload when rotating multiple vectors by the same angle,
+			///so the sine and cosine only needs to be computed once
+			[[nodiscard]] Vector2 Deviant(real sin_of_angle, real cos_of_angle) const noexcept;
+
 			///@brief Returns a vector that deviates from this vector by a given angle (radians) in a random direction
 			[[nodiscard]] Vector2 RandomDeviant(real angle) const noexcept;
 
@@ -544,6 +549,12 @@ namespace ion::graphics::utilities
 			///@details Returns the result as a copy
 			[[nodiscard]] Vector2 RotateCopy(real angle, const Vector2 &origin) const noexcept;
 
+			///@brief Rotates point by the given precomputed sine and cosine of an angle and origin vector
+			///@details Returns the result as a copy.
+			///Use this overload when rotating multiple points by the same angle,
+			///so the sine and cosine only needs to be computed once
+			[[nodiscard]] Vector2 RotateCopy(real sin_of_angle, real cos_of_angle, const Vector2 &origin) const noexcept;
+
 			///@}
 
 			/**
@@ -134,9 +134,11 @@ real Vector3::DotProduct(const Vector3 &vector) const noexcept
 
 Vector3 Vector3::Deviant(real angle) const noexcept
 {
-	auto sin_of_angle = math::Sin(angle);
-	auto cos_of_angle = math::Cos(angle);
+	return Deviant(math::Sin(angle), math::Cos(angle));
+}
 
+Vector3 Vector3::Deviant(real sin_of_angle, real cos_of_angle) const noexcept
+{
 	#ifdef ION_LEFT_HANDED
 	//Left-hand rotation CW
 	return {cos_of_angle * x_ + sin_of_angle * y_,
@@ -401,6 +403,11 @@ Vector3 Vector3::RotateCopy(real angle, const Vector3 &origin) const noexcept
 	return (*this - origin).Deviant(angle) + origin;
 }
 
+Vector3 Vector3::RotateCopy(real sin_of_angle, real cos_of_angle, const Vector3 &origin) const noexcept
+{
+	return (*this - origin).Deviant(sin_of_angle, cos_of_angle) + origin;
+}
+
 
 /*
 	Scaling
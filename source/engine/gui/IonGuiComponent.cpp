@@ -25,12 +25,15 @@ namespace gui_component::detail
 
 bool is_descendant_of(const GuiContainer &owner, const GuiComponent &component) noexcept
 {
-	if (auto component_owner = component.Owner(); component_owner == &owner)
-		return true;
-	else if (component_owner)
-		return is_descendant_of(owner, *component_owner); //Recursive
-	else
-		return false;
+	//Walk up the owner chain iteratively (not guaranteed to be tail call optimized in all builds)
+	for (auto component_owner = component.Owner(); component_owner;
+		component_owner = component_owner->Owner())
+	{
+		if (component_owner == &owner)
+			return true;
+	}
+
+	return false;
 }
 
 } //gui_component::detail
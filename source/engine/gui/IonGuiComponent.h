@@ -34,6 +34,13 @@ namespace ion::gui
 	//Forward declarations
 	class GuiComponent;
 	class GuiContainer;
+	class GuiPanel;
+	class GuiPanelContainer;
+
+	namespace controls
+	{
+		class GuiControl; //Forward declaration
+	}
 
 	using namespace graphics::scene::graph;
 
@@ -267,6 +274,31 @@ namespace ion::gui
 			}
 
 
+			///@brief Returns a pointer to this component as a control
+			///@details Returns nullptr if this component is not a control.
+			///Overridden by GuiControl, and much cheaper than a dynamic_cast when walking components
+			[[nodiscard]] virtual controls::GuiControl* AsControl() noexcept
+			{
+				return nullptr;
+			}
+
+			///@brief Returns a pointer to this component as a panel
+			///@details Returns nullptr if this component is not a panel.
+			///Overridden by GuiPanel, and much cheaper than a dynamic_cast when walking components
+			[[nodiscard]] virtual GuiPanel* AsPanel() noexcept
+			{
+				return nullptr;
+			}
+
+			///@brief Returns a pointer to this component as a panel container
+			///@details Returns nullptr if this component is not a panel container.
+			///Overridden by GuiPanelContainer, and much cheaper than a dynamic_cast when resolving owners
+			[[nodiscard]] virtual GuiPanelContainer* AsPanelContainer() noexcept
+			{
+				return nullptr;
+			}
+
+
 			///@brief Returns the on enable callback
 			[[nodiscard]] inline auto OnEnable() const noexcept
 			{
@@ -28,9 +28,9 @@ void get_ordered_controls(GuiPanelContainer &owner, control_pointers &controls)
 {
 	for (auto &component : owner.OrderedComponents())
 	{
-		if (auto control = dynamic_cast<controls::GuiControl*>(&component); control)
+		if (auto control = component.AsControl(); control)
 			controls.push_back(control);
-		else if (auto panel = dynamic_cast<GuiPanel*>(&component); panel)
+		else if (auto panel = component.AsPanel(); panel)
 			get_ordered_controls(*panel, controls); //Recursive
 	}
 }
@@ -388,6 +388,13 @@ namespace ion::gui
 				return static_cast<GuiPanelContainer*>(owner_);
 			}
 
+
+			///@brief Returns a pointer to this component as a panel
+			[[nodiscard]] virtual GuiPanel* AsPanel() noexcept override
+			{
+				return this;
+			}
+
 			///@}
 
 			/**
@@ -182,6 +182,13 @@ namespace ion::gui
 			///@brief Returns a pointer to the parent frame of this container
 			[[nodiscard]] GuiFrame* ParentFrame() const noexcept;
 
+
+			///@brief Returns a pointer to this component as a panel container
+			[[nodiscard]] virtual GuiPanelContainer* AsPanelContainer() noexcept override
+			{
+				return this;
+			}
+
 			///@}
 
 			/**
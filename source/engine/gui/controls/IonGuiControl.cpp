@@ -1245,7 +1245,9 @@ std::optional<Aabb> GuiControl::HitArea() const noexcept
 
 GuiPanelContainer* GuiControl::Owner() const noexcept
 {
-	return dynamic_cast<GuiPanelContainer*>(owner_);
+	//Mouse cursors and tooltips are owned directly by the controller,
+	//so the owner is not necessarily a panel container
+	return owner_ ? owner_->AsPanelContainer() : nullptr;
 }
 
 
@@ -901,6 +901,13 @@ namespace ion::gui::controls
 			}
 
 
+			///@brief Returns a pointer to this component as a control
+			[[nodiscard]] virtual GuiControl* AsControl() noexcept override
+			{
+				return this;
+			}
+
+
 			///@brief Returns the skin attached to this control
 			///@details Returns nullptr if no skin is attached
 			[[nodiscard]] inline auto Skin() const noexcept
@@ -189,13 +189,15 @@ bool GuiScrollBar::MouseReleased(MouseButton button, Vector2 position) noexcept
 
 					if (skin_node_)
 					{
+						auto &scaling = skin_node_->DerivedScaling();
+
 						position = //Make position relative to skin
 							(position - skin_node_->DerivedPosition()).
 							RotateCopy(-skin_node_->DerivedRotation(), vector2::Zero);
-						size = (*size - skin.Handle->Size()) * skin_node_->DerivedScaling();
+						size = (*size - handle_size) * scaling;
 
-						handle_size *= skin_node_->DerivedScaling();
-						handle_position *= skin_node_->DerivedScaling();
+						handle_size *= scaling;
+						handle_position *= scaling;
 					}
 
 					handle_position +=